@@ -1,10 +1,14 @@
 set(INCLUDES
     include/dna/BinaryStreamReader.h
     include/dna/BinaryStreamWriter.h
+    include/dna/ByteOrder.h
     include/dna/DataLayer.h
     include/dna/Defs.h
     include/dna/JSONStreamReader.h
     include/dna/JSONStreamWriter.h
+    include/dna/LazyBinaryStreamReader.h
+    include/dna/MemoryReport.h
+    include/dna/ReadMode.h
     include/dna/Reader.h
     include/dna/StreamReader.h
     include/dna/StreamWriter.h
@@ -63,6 +67,8 @@ set(INCLUDES
     include/pma/resources/AlignedMemoryResource.h
     include/pma/resources/ArenaMemoryResource.h
     include/pma/resources/DefaultMemoryResource.h
+    include/pma/resources/PoolMemoryResource.h
+    include/pma/resources/TrackingMemoryResource.h
     include/pma/utils/ManagedInstance.h
     include/pma/version/Version.h
     include/status/Defs.h
@@ -73,6 +79,7 @@ set(INCLUDES
     include/trio/Concepts.h
     include/trio/Defs.h
     include/trio/Stream.h
+    include/trio/streams/BufferedStream.h
     include/trio/streams/FileStream.h
     include/trio/streams/MemoryMappedFileStream.h
     include/trio/streams/MemoryStream.h
@@ -81,14 +88,19 @@ set(INCLUDES
     include/trio/utils/StreamScope.h
     include/trio/version/Version.h)
 set(SOURCES
+    src/dna/ArrayCopyingWriter.h
     src/dna/BaseImpl.h
     src/dna/DNA.h
     src/dna/DataLayerBitmask.h
     src/dna/DenormalizedData.h
+    src/dna/ImplementationRegistry.h
     src/dna/LODConstraint.cpp
     src/dna/LODConstraint.h
     src/dna/LODMapping.cpp
     src/dna/LODMapping.h
+    src/dna/MemoryReporter.h
+    src/dna/NameIndex.h
+    src/dna/NameIndexedReader.h
     src/dna/Reader.cpp
     src/dna/ReaderImpl.h
     src/dna/SurjectiveMapping.h
@@ -114,11 +126,19 @@ set(SOURCES
     src/dna/stream/JSONStreamReaderImpl.h
     src/dna/stream/JSONStreamWriterImpl.cpp
     src/dna/stream/JSONStreamWriterImpl.h
+    src/dna/stream/LayoutAwareOutputArchive.h
+    src/dna/stream/LazyBinaryStreamReaderImpl.cpp
+    src/dna/stream/LazyBinaryStreamReaderImpl.h
+    src/dna/stream/StreamCursor.cpp
+    src/dna/stream/StreamCursor.h
     src/dna/stream/StreamReader.cpp
     src/dna/stream/StreamWriter.cpp
     src/dna/types/Limits.h
     src/dna/utils/Extd.h
     src/dna/utils/ScopedEnumEx.h
+    src/dna/utils/SynchronizedMemoryResource.cpp
+    src/dna/utils/SynchronizedMemoryResource.h
+    src/dna/utils/ThreadGroup.h
     src/dnacalib/Command.cpp
     src/dnacalib/CommandImplBase.h
     src/dnacalib/TypeDefs.h
@@ -158,6 +178,7 @@ set(SOURCES
     src/dnacalib/dna/LODMapping.cpp
     src/dnacalib/dna/LODMapping.h
     src/dnacalib/dna/ReaderImpl.h
+    src/dnacalib/dna/SharedArrays.h
     src/dnacalib/dna/SurjectiveMapping.h
     src/dnacalib/dna/WriterImpl.h
     src/dnacalib/dna/filters/AnimatedMapFilter.cpp
@@ -183,6 +204,8 @@ set(SOURCES
     src/pma/resources/AlignedMemoryResource.cpp
     src/pma/resources/ArenaMemoryResource.cpp
     src/pma/resources/DefaultMemoryResource.cpp
+    src/pma/resources/PoolMemoryResource.cpp
+    src/pma/resources/TrackingMemoryResource.cpp
     src/status/PredefinedCodes.h
     src/status/Provider.cpp
     src/status/Registry.cpp
@@ -219,8 +242,13 @@ set(SOURCES
     src/terse/version/Version.h
     src/trio/Concepts.cpp
     src/trio/Stream.cpp
+    src/trio/streams/BufferedStreamImpl.cpp
+    src/trio/streams/BufferedStreamImpl.h
+    src/trio/streams/FileStreamBase.h
     src/trio/streams/FileStreamImpl.cpp
     src/trio/streams/FileStreamImpl.h
+    src/trio/streams/FileStreamUnix.cpp
+    src/trio/streams/FileStreamUnix.h
     src/trio/streams/MemoryMappedFileStream.cpp
     src/trio/streams/MemoryMappedFileStreamFallback.cpp
     src/trio/streams/MemoryMappedFileStreamFallback.h
@@ -228,12 +256,28 @@ set(SOURCES
     src/trio/streams/MemoryMappedFileStreamUnix.h
     src/trio/streams/MemoryMappedFileStreamWindows.cpp
     src/trio/streams/MemoryMappedFileStreamWindows.h
+    src/trio/streams/MemoryStreamBase.h
     src/trio/streams/MemoryStreamImpl.cpp
     src/trio/streams/MemoryStreamImpl.h
+    src/trio/streams/MemoryStreamView.cpp
+    src/trio/streams/MemoryStreamView.h
+    src/trio/streams/PositionalReadable.cpp
+    src/trio/streams/PositionalReadable.h
     src/trio/streams/StreamStatus.cpp
     src/trio/streams/StreamStatus.h
     src/trio/utils/NativeString.h
     src/trio/utils/PlatformWindows.h
     src/trio/utils/ScopedEnumEx.h)
 set(TESTS
-    )
+    src/dna/ReaderTest.cpp
+    src/dna/WriterTest.cpp
+    src/dna/stream/BinaryStreamReaderTest.cpp
+    src/dna/stream/BinaryStreamWriterTest.cpp
+    src/dna/stream/LazyBinaryStreamReaderTest.cpp
+    src/dnacalib/commands/CommandSequenceTest.cpp
+    src/dnacalib/dna/DNACalibDNAReaderTest.cpp
+    src/fixtures/TestDNA.cpp
+    src/fixtures/TestDNA.h
+    src/pma/resources/ArenaMemoryResourceTest.cpp
+    src/pma/resources/PoolMemoryResourceTest.cpp
+    src/pma/resources/TrackingMemoryResourceTest.cpp)
@@ -4,6 +4,7 @@
 
 #include "dna/DataLayer.h"
 #include "dna/Defs.h"
+#include "dna/ReadMode.h"
 #include "dna/StreamReader.h"
 #include "dna/types/Aliases.h"
 
@@ -72,6 +73,82 @@ class DNAAPI BinaryStreamReader : public StreamReader {
                                           std::uint16_t maxLOD,
                                           std::uint16_t minLOD,
                                           MemoryResource* memRes = nullptr);
+        /**
+            @brief Factory method for creation of BinaryStreamReader
+            @param stream
+                Source stream from which data is going to be read.
+            @param layer
+                Specify the layer up to which the data needs to be loaded.
+            @note
+                The Definition data layer depends on and thus implicitly loads the Descriptor layer.
+                The Behavior data layer depends on and thus implicitly loads the Definition layer.
+                The Geometry data layer depends on and thus also implicitly loads the Definition layer.
+            @param maxLOD
+                The maximum level of details to be loaded.
+            @param minLOD
+                The minimum level of details to be loaded.
+            @note
+                A range of [0, LOD count - 1] for maxLOD / minLOD respectively indicates to load all LODs.
+            @warning
+                Both maxLOD and minLOD values must be less than the value returned by getLODCount.
+            @see getLODCount
+            @param threadCount
+                The number of threads used to load the meshes of the Geometry layer.
+            @note
+                With more than one thread, the meshes are loaded concurrently, each into its own memory region allocated
+                from the given memory resource. Each thread reads only the meshes it loads, through its own position in the
+                stream (and a small buffer of its own), while accesses to the stream itself are serialized.
+                A value of zero or one loads the meshes on the calling thread only, one after the other.
+            @warning
+                When multiple threads are used, the given memory resource may be invoked from any of them, although
+                never from more than one thread at a time.
+            @param memRes
+                Memory resource to be used for allocations.
+            @note
+                If a memory resource is not given, a default allocation mechanism will be used.
+            @warning
+                User is responsible for releasing the returned pointer by calling destroy.
+            @see destroy
+        */
+        static BinaryStreamReader* create(BoundedIOStream* stream,
+                                          DataLayer layer,
+                                          std::uint16_t maxLOD,
+                                          std::uint16_t minLOD,
+                                          std::uint16_t threadCount,
+                                          MemoryResource* memRes = nullptr);
+        /**
+            @brief Factory method for creation of BinaryStreamReader
+            @param stream
+                Source stream from which data is going to be read.
+            @param layer
+                Specify the layer up to which the data needs to be loaded.
+            @note
+                The Definition data layer depends on and thus implicitly loads the Descriptor layer.
+                The Behavior data layer depends on and thus implicitly loads the Definition layer.
+                The Geometry data layer depends on and thus also implicitly loads the Definition layer.
+            @param lods
+                An array specifying which exact lods to load.
+            @warning
+                All values in the array must be less than the value returned by getLODCount.
+            @see getLODCount
+            @param lodCount
+                The number of elements in the lods array.
+            @warning
+                There cannot be more elements in the array than the value returned by getLODCount.
+            @see getLODCount
+            @param memRes
+                Memory resource to be used for allocations.
+            @note
+                If a memory resource is not given, a default allocation mechanism will be used.
+            @warning
+                User is responsible for releasing the returned pointer by calling destroy.
+            @see destroy
+        */
+        static BinaryStreamReader* create(BoundedIOStream* stream,
+                                          DataLayer layer,
+                                          std::uint16_t* lods,
+                                          std::uint16_t lodCount,
+                                          MemoryResource* memRes = nullptr);
         /**
             @brief Factory method for creation of BinaryStreamReader
             @param stream
@@ -92,6 +169,10 @@ class DNAAPI BinaryStreamReader : public StreamReader {
             @warning
                 There cannot be more elements in the array than the value returned by getLODCount.
             @see getLODCount
+            @param threadCount
+                The number of threads used to load the meshes of the Geometry layer.
+            @note
+                Meshes are loaded concurrently just as with the overload taking maxLOD and minLOD along with a thread count.
             @param memRes
                 Memory resource to be used for allocations.
             @note
@@ -104,6 +185,50 @@ class DNAAPI BinaryStreamReader : public StreamReader {
                                           DataLayer layer,
                                           std::uint16_t* lods,
                                           std::uint16_t lodCount,
+                                          std::uint16_t threadCount,
+                                          MemoryResource* memRes = nullptr);
+        /**
+            @brief Factory method for creation of BinaryStreamReader
+            @param stream
+                Memory mapped source stream from which data is going to be read.
+            @param mode
+                Specify whether the loaded data is copied out of the stream, or referenced directly within it.
+            @note
+                In ReadMode::Borrow, data that is stored in the native byte order of the platform is not copied, but the
+                reader refers to the memory mapped contents of the stream instead, so the stream is left open after read.
+                Data that is not directly accessible (e.g. because it needs byte swapping, or the stream could not map the whole
+                file at once) is still copied as in ReadMode::Copy.
+            @warning
+                In ReadMode::Borrow, the stream must be opened with AccessMode::Read, and it must not be closed or destroyed
+                while data is still being accessed through the reader.
+            @param layer
+                Specify the layer up to which the data needs to be loaded.
+            @note
+                The Definition data layer depends on and thus implicitly loads the Descriptor layer.
+                The Behavior data layer depends on and thus implicitly loads the Definition layer.
+                The Geometry data layer depends on and thus also implicitly loads the Definition layer.
+            @param maxLOD
+                The maximum level of details to be loaded.
+            @param minLOD
+                The minimum level of details to be loaded.
+            @note
+                A range of [0, LOD count - 1] for maxLOD / minLOD respectively indicates to load all LODs.
+            @warning
+                Both maxLOD and minLOD values must be less than the value returned by getLODCount.
+            @see getLODCount
+            @param memRes
+                Memory resource to be used for allocations.
+            @note
+                If a memory resource is not given, a default allocation mechanism will be used.
+            @warning
+                User is responsible for releasing the returned pointer by calling destroy.
+            @see destroy
+        */
+        static BinaryStreamReader* create(MemoryMappedFileStream* stream,
+                                          ReadMode mode,
+                                          DataLayer layer,
+                                          std::uint16_t maxLOD,
+                                          std::uint16_t minLOD,
                                           MemoryResource* memRes = nullptr);
         /**
             @brief Method for freeing a BinaryStreamReader instance.
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "dna/ByteOrder.h"
 #include "dna/Defs.h"
 #include "dna/StreamWriter.h"
 #include "dna/types/Aliases.h"
@@ -23,6 +24,54 @@ class DNAAPI BinaryStreamWriter : public StreamWriter {
             @see destroy
         */
         static BinaryStreamWriter* create(BoundedIOStream* stream, MemoryResource* memRes = nullptr);
+        /**
+            @brief Factory method for creation of BinaryStreamWriter
+            @param stream
+                Stream into which the data is going to be written.
+            @param byteOrder
+                Byte order in which the data is going to be written.
+            @note
+                ByteOrder::Native avoids byte swapping both while writing and reading on platforms of the same byte order,
+                but the produced files can only be read by versions of the library that support format version 2.2.
+            @param memRes
+                Memory resource to be used for allocations.
+            @note
+                If a memory resource is not given, a default allocation mechanism will be used.
+            @warning
+                User is responsible for releasing the returned pointer by calling destroy.
+            @see destroy
+        */
+        static BinaryStreamWriter* create(BoundedIOStream* stream, ByteOrder byteOrder, MemoryResource* memRes = nullptr);
+        /**
+            @brief Factory method for creation of BinaryStreamWriter
+            @param stream
+                Stream into which the data is going to be written.
+            @param byteOrder
+                Byte order in which the data is going to be written.
+            @param threadCount
+                The number of threads used to serialize the data.
+            @note
+                With more than one thread, the Descriptor, Definition and Behavior layers and each mesh of the Geometry layer
+                are serialized concurrently, each into its own in-memory buffer, which are written into the stream one after
+                the other, so the produced data is the same regardless of the number of threads used.
+                Each buffer is freed as soon as it's written into the stream, and only a small number of buffers (proportional
+                to the number of threads) is kept in memory at any time.
+                A value of zero or one writes all data directly into the stream, on the calling thread only.
+            @warning
+                When multiple threads are used, the given memory resource may be invoked from any of them, although
+                never from more than one thread at a time.
+            @param memRes
+                Memory resource to be used for allocations.
+            @note
+                If a memory resource is not given, a default allocation mechanism will be used.
+            @warning
+                User is responsible for releasing the returned pointer by calling destroy.
+            @see destroy
+        */
+        static BinaryStreamWriter* create(BoundedIOStream* stream,
+                                          ByteOrder byteOrder,
+                                          std::uint16_t threadCount,
+                                          MemoryResource* memRes = nullptr);
         /**
             @brief Method for freeing a BinaryStreamWriter instance.
             @param instance
@@ -0,0 +1,14 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+namespace dna {
+
+enum class ByteOrder {
+    Network,  // Big-endian, readable by all versions of the library
+    // Byte order of the writing platform (with array elements aligned for direct access), written in file format version
+    // 2.2, so readable only by versions of the library that support that file format version
+    Native
+};
+
+}  // namespace dna
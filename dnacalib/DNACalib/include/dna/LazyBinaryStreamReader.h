@@ -0,0 +1,98 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "dna/Defs.h"
+#include "dna/StreamReader.h"
+#include "dna/types/Aliases.h"
+
+namespace dna {
+
+/**
+    @brief A binary stream reader which loads only the Descriptor and Definition layers upfront, while the Behavior layer and
+        the Geometry layer (mesh by mesh, with blend shape targets separately from the rest of each mesh) are loaded on demand,
+        when first accessed through any of the getters.
+    @note
+        Errors encountered while loading data on demand are reported through the status (which each such load resets first),
+        and the getters that triggered the load return empty data. The failed load is attempted again on next access.
+    @warning
+        The stream is opened by read, and is left open afterwards, so the remaining data can be loaded from it later on.
+        It must not be closed or destroyed while the reader is still in use.
+    @warning
+        As getters may load data, calling them concurrently from multiple threads is not safe.
+*/
+class DNAAPI LazyBinaryStreamReader : public StreamReader {
+    public:
+        /**
+            @brief Factory method for creation of LazyBinaryStreamReader
+            @param stream
+                Source stream from which data is going to be read.
+            @param maxLOD
+                The maximum level of details to be loaded.
+            @note
+                A value of zero indicates to load all LODs.
+            @warning
+                The maxLOD value must be less than the value returned by getLODCount.
+            @see getLODCount
+            @param memRes
+                Memory resource to be used for allocations.
+            @note
+                If a memory resource is not given, a default allocation mechanism will be used.
+            @warning
+                User is responsible for releasing the returned pointer by calling destroy.
+            @see destroy
+        */
+        static LazyBinaryStreamReader* create(BoundedIOStream* stream,
+                                              std::uint16_t maxLOD = 0u,
+                                              MemoryResource* memRes = nullptr);
+        /**
+            @brief Factory method for creation of LazyBinaryStreamReader
+            @param stream
+                Source stream from which data is going to be read.
+            @param maxLOD
+                The maximum level of details to be loaded.
+            @param minLOD
+                The minimum level of details to be loaded.
+            @note
+                A range of [0, LOD count - 1] for maxLOD / minLOD respectively indicates to load all LODs.
+            @warning
+                Both maxLOD and minLOD values must be less than the value returned by getLODCount.
+            @see getLODCount
+            @param memRes
+                Memory resource to be used for allocations.
+            @note
+                If a memory resource is not given, a default allocation mechanism will be used.
+            @warning
+                User is responsible for releasing the returned pointer by calling destroy.
+            @see destroy
+        */
+        static LazyBinaryStreamReader* create(BoundedIOStream* stream,
+                                              std::uint16_t maxLOD,
+                                              std::uint16_t minLOD,
+                                              MemoryResource* memRes = nullptr);
+        /**
+            @brief Method for freeing a LazyBinaryStreamReader instance.
+            @param instance
+                Instance of LazyBinaryStreamReader to be freed.
+            @see create
+        */
+        static void destroy(LazyBinaryStreamReader* instance);
+
+        ~LazyBinaryStreamReader() override;
+};
+
+}  // namespace dna
+
+namespace pma {
+
+template<>
+struct DefaultInstanceCreator<dna::LazyBinaryStreamReader> {
+    using type = pma::FactoryCreate<dna::LazyBinaryStreamReader>;
+};
+
+template<>
+struct DefaultInstanceDestroyer<dna::LazyBinaryStreamReader> {
+    using type = pma::FactoryDestroy<dna::LazyBinaryStreamReader>;
+};
+
+}  // namespace pma
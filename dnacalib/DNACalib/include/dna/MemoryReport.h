@@ -0,0 +1,58 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+
+namespace dna {
+
+/**
+    @brief Number of bytes occupied by the data of a single mesh.
+    @see getMeshMemoryReport
+*/
+struct MeshMemoryReport {
+    std::size_t positions;
+    std::size_t textureCoordinates;
+    std::size_t normals;
+    std::size_t layouts;
+    std::size_t faces;
+    std::size_t skinWeights;
+    std::size_t blendShapeTargets;
+
+    std::size_t total() const {
+        return positions + textureCoordinates + normals + layouts + faces + skinWeights + blendShapeTargets;
+    }
+
+};
+
+/**
+    @brief Number of bytes occupied by the data of each section of the DNA.
+    @note
+        Only the data held by the arrays and strings of each section is counted, so the numbers are independent of
+        the memory resource used, and do not include allocator overhead or the fixed size of the containers themselves.
+    @see getMemoryReport
+*/
+struct MemoryReport {
+    // Descriptor name, metadata and database strings
+    std::size_t descriptor;
+    // LOD mappings, mesh to blend shape channel mapping, joint hierarchy and neutral joint transforms
+    std::size_t definition;
+    // Names of controls, joints, blend shape channels, animated maps and meshes
+    std::size_t names;
+    // GUI to raw control conditionals
+    std::size_t conditionals;
+    std::size_t psds;
+    std::size_t jointGroups;
+    std::size_t blendShapeChannels;
+    std::size_t animatedMaps;
+    // Sum of all meshes, see getMeshMemoryReport for each mesh separately
+    std::size_t geometry;
+
+    std::size_t total() const {
+        return descriptor + definition + names + conditionals + psds + jointGroups + blendShapeChannels + animatedMaps +
+               geometry;
+    }
+
+};
+
+}  // namespace dna
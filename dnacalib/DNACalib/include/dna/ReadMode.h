@@ -0,0 +1,12 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+namespace dna {
+
+enum class ReadMode {
+    Copy,  // Data is copied out of the stream into storage owned by the reader
+    Borrow  // Data is referenced directly within the mapped stream wherever possible (the stream is kept open)
+};
+
+}  // namespace dna
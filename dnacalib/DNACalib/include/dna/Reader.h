@@ -4,6 +4,7 @@
 
 #include "dna/Defs.h"
 #include "dna/DataLayer.h"
+#include "dna/MemoryReport.h"
 #include "dna/layers/BehaviorReader.h"
 #include "dna/layers/GeometryReader.h"
 
@@ -29,4 +30,32 @@ class DNAAPI Reader : public BehaviorReader, public GeometryReader {
         virtual void unload(DataLayer layer) = 0;
 };
 
+/**
+    @brief Number of bytes occupied by the data of each section of the DNA that is currently loaded by the given Reader.
+    @note
+        Data of layers that were not loaded (or were unloaded since) is not counted, and neither is data that
+        a lazy reader did not load yet.
+    @note
+        The report may be used to decide which layers or LODs to drop, before the DNA is shipped to targets
+        with constrained memory.
+    @param reader
+        The Reader whose data is to be reported.
+    @return
+        Report of the Reader, all zeros if the Reader is not one of the Readers created by this library.
+*/
+DNAAPI MemoryReport getMemoryReport(const Reader* reader);
+/**
+    @brief Number of bytes occupied by the data of the given mesh of the given Reader.
+    @param reader
+        The Reader whose data is to be reported.
+    @param meshIndex
+        A mesh's position in the zero-indexed array of meshes.
+    @warning
+        meshIndex must be less than the value returned by getMeshCount.
+    @return
+        Report of the mesh, all zeros if the geometry of the mesh is not loaded, or if the Reader is not one of the
+        Readers created by this library.
+*/
+DNAAPI MeshMemoryReport getMeshMemoryReport(const Reader* reader, std::uint16_t meshIndex);
+
 }  // namespace dna
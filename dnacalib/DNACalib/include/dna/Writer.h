@@ -30,7 +30,8 @@ class DNAAPI Writer : public BehaviorWriter, public GeometryWriter {
                 by calling each getter function of the Reader, and passing the return values to
                 the matching setter functions in the Writer.
                 It is implemented in the abstract class itself to provide the functionality for
-                all DNA Writers.
+                all DNA Writers, while the built-in Writers copy whole arrays at once wherever
+                possible.
             @param source
                 The source DNA Reader from which the data needs to be copied.
             @param layer
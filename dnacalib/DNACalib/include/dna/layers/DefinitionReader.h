@@ -281,4 +281,80 @@ class DNAAPI DefinitionReader : public DescriptorReader {
         virtual ConstArrayView<float> getNeutralJointRotationZs() const = 0;
 };
 
+/**
+    @brief Index of the GUI control with the given name.
+    @note
+        Readers created by this library look names up in an index, which is built on first use and kept up to date
+        when names change, while for other Readers the names are compared one by one.
+    @param reader
+        The Reader whose GUI control names are searched.
+    @param name
+        The name of the GUI control, as a null-terminated string.
+    @return
+        A name's position in the zero-indexed array of GUI control names (of the first one, if the name occurs
+        multiple times), or UINT16_MAX if no GUI control has the given name.
+    @see DefinitionReader::getGUIControlName
+*/
+DNAAPI std::uint16_t getGUIControlIndexByName(const DefinitionReader* reader, const char* name);
+/**
+    @brief Index of the raw control with the given name.
+    @param reader
+        The Reader whose raw control names are searched.
+    @param name
+        The name of the raw control, as a null-terminated string.
+    @return
+        A name's position in the zero-indexed array of raw control names (of the first one, if the name occurs
+        multiple times), or UINT16_MAX if no raw control has the given name.
+    @see DefinitionReader::getRawControlName
+*/
+DNAAPI std::uint16_t getRawControlIndexByName(const DefinitionReader* reader, const char* name);
+/**
+    @brief Index of the joint with the given name.
+    @param reader
+        The Reader whose joint names are searched.
+    @param name
+        The name of the joint, as a null-terminated string.
+    @return
+        A name's position in the zero-indexed array of joint names (of the first one, if the name occurs
+        multiple times), or UINT16_MAX if no joint has the given name.
+    @see DefinitionReader::getJointName
+*/
+DNAAPI std::uint16_t getJointIndexByName(const DefinitionReader* reader, const char* name);
+/**
+    @brief Index of the blend shape channel with the given name.
+    @param reader
+        The Reader whose blend shape channel names are searched.
+    @param name
+        The name of the blend shape channel, as a null-terminated string.
+    @return
+        A name's position in the zero-indexed array of blend shape channel names (of the first one, if the name occurs
+        multiple times), or UINT16_MAX if no blend shape channel has the given name.
+    @see DefinitionReader::getBlendShapeChannelName
+*/
+DNAAPI std::uint16_t getBlendShapeChannelIndexByName(const DefinitionReader* reader, const char* name);
+/**
+    @brief Index of the animated map with the given name.
+    @param reader
+        The Reader whose animated map names are searched.
+    @param name
+        The name of the animated map, as a null-terminated string.
+    @return
+        A name's position in the zero-indexed array of animated map names (of the first one, if the name occurs
+        multiple times), or UINT16_MAX if no animated map has the given name.
+    @see DefinitionReader::getAnimatedMapName
+*/
+DNAAPI std::uint16_t getAnimatedMapIndexByName(const DefinitionReader* reader, const char* name);
+/**
+    @brief Index of the mesh with the given name.
+    @param reader
+        The Reader whose mesh names are searched.
+    @param name
+        The name of the mesh, as a null-terminated string.
+    @return
+        A name's position in the zero-indexed array of mesh names (of the first one, if the name occurs
+        multiple times), or UINT16_MAX if no mesh has the given name.
+    @see DefinitionReader::getMeshName
+*/
+DNAAPI std::uint16_t getMeshIndexByName(const DefinitionReader* reader, const char* name);
+
 }  // namespace dna
@@ -10,6 +10,7 @@
 #include <status/Status.h>
 #include <status/StatusCode.h>
 #include <trio/Stream.h>
+#include <trio/streams/BufferedStream.h>
 #include <trio/streams/FileStream.h>
 #include <trio/streams/MemoryMappedFileStream.h>
 #include <trio/streams/MemoryStream.h>
@@ -23,6 +24,7 @@ template<typename T>
 using ConstArrayView = trust::ConstArrayView<T>;
 
 using trio::BoundedIOStream;
+using trio::BufferedStream;
 using trio::FileStream;
 using trio::MemoryMappedFileStream;
 using trio::MemoryStream;
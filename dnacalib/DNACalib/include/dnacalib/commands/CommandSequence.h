@@ -16,6 +16,9 @@ class DNACalibDNAReader;
         Commands will be run in the order in which they were added to the sequence.
     @note
         CommandSequence holds pointers to commands, but does not own them.
+    @note
+        In transactional mode, a failing command stops the sequence, and the DNA is restored to its state from before
+        the sequence was run, while the status of the failed command is kept.
 */
 class CommandSequence : public Command {
     public:
@@ -89,6 +92,44 @@ class CommandSequence : public Command {
         */
         DNACAPI std::size_t size() const;
 
+        /**
+            @brief Method for enabling or disabling transactional mode (disabled by default).
+            @note
+                In transactional mode, each run keeps the state of the DNA from before it, which is restored if any of
+                the commands fails, and can otherwise be restored by rollback().
+            @note
+                The state is kept as a clone of the DNA (see DNACalibDNAReader::clone), so only the arrays that the
+                commands actually replace take additional memory, while all other arrays are shared with it.
+            @param transactional
+                True to enable transactional mode, false to disable it (which also discards the kept state).
+        */
+        DNACAPI void setTransactional(bool transactional);
+
+        /**
+            @brief Whether transactional mode is enabled.
+        */
+        DNACAPI bool isTransactional() const;
+
+        /**
+            @brief Method for restoring the DNA passed to the last run to its state from before that run.
+            @note
+                The DNA must still exist, and must not have been modified otherwise since the run.
+            @return
+                False if there was no state to restore, i.e. if transactional mode is disabled, nothing was run yet,
+                or the state was already restored or committed.
+        */
+        DNACAPI bool rollback();
+
+        /**
+            @brief Method for discarding the state kept by the last run, which can no longer be restored afterwards.
+            @note
+                All memory taken by the kept state is released, so the DNA takes no more memory than it would have
+                taken if it was not run in transactional mode.
+            @note
+                The DNA must still exist.
+        */
+        DNACAPI void commit();
+
     private:
         class Impl;
         ScopedPtr<Impl> pImpl;
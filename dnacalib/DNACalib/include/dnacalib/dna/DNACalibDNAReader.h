@@ -5,6 +5,7 @@
 #include "dnacalib/Defs.h"
 #include "dnacalib/types/Aliases.h"
 
+#include <dna/BinaryStreamReader.h>
 #include <dna/Reader.h>
 
 namespace dnac {
@@ -13,6 +14,31 @@ class DNACAPI DNACalibDNAReader : public dna::Reader {
     public:
         static DNACalibDNAReader* create(MemoryResource* memRes = nullptr);
         static DNACalibDNAReader* create(const dna::Reader* reader, MemoryResource* memRes = nullptr);
+        /**
+            @brief Creates a reader by taking over the data loaded by the given reader, instead of copying it.
+            @note
+                The data is handed over array by array, so the cost depends only on the number of arrays (e.g. the
+                number of meshes and blend shape targets), not on the size of the data. Data that is not owned by
+                the given reader's memory resource (e.g. meshes loaded with multiple threads), or that is borrowed
+                from a memory mapped stream, is copied instead.
+            @param reader
+                The reader whose data is taken over. The created reader uses its memory resource. It's left unloaded,
+                so it's meant to be destroyed afterwards.
+        */
+        static DNACalibDNAReader* adopt(dna::BinaryStreamReader* reader);
+        /**
+            @brief Creates a copy of the given reader that shares its largest arrays with it, instead of copying them.
+            @note
+                Vertex positions, texture coordinates, normals and layouts of all meshes, blend shape target deltas and
+                vertex indices, and joint group values are shared, while all other data is copied. A shared array is
+                copied only by the reader that first modifies it (e.g. through a command), so each clone takes memory
+                proportional to the data actually changed through it. Each shared array is freed as soon as no reader
+                uses it anymore, so destroying a clone gives back all memory it took.
+            @param source
+                The reader to clone. The created reader uses its memory resource. Cloning moves its data into shared
+                storage, so it must not be used by other threads meanwhile.
+        */
+        static DNACalibDNAReader* clone(DNACalibDNAReader* source);
         static void destroy(DNACalibDNAReader* instance);
 
     protected:
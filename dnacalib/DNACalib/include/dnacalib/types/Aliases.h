@@ -2,11 +2,15 @@
 
 #pragma once
 
+#include <dna/ByteOrder.h>
 #include <dna/DataLayer.h>
 #include <dna/BinaryStreamReader.h>
 #include <dna/BinaryStreamWriter.h>
 #include <dna/JSONStreamReader.h>
 #include <dna/JSONStreamWriter.h>
+#include <dna/LazyBinaryStreamReader.h>
+#include <dna/MemoryReport.h>
+#include <dna/ReadMode.h>
 #include <dna/StreamReader.h>
 #include <dna/StreamWriter.h>
 #include <dna/types/Aliases.h>
@@ -16,9 +20,12 @@
 #include <pma/resources/AlignedMemoryResource.h>
 #include <pma/resources/ArenaMemoryResource.h>
 #include <pma/resources/DefaultMemoryResource.h>
+#include <pma/resources/PoolMemoryResource.h>
+#include <pma/resources/TrackingMemoryResource.h>
 #include <status/Status.h>
 #include <status/StatusCode.h>
 #include <trio/Stream.h>
+#include <trio/streams/BufferedStream.h>
 #include <trio/streams/FileStream.h>
 #include <trio/streams/MemoryMappedFileStream.h>
 #include <trio/streams/MemoryStream.h>
@@ -27,14 +34,20 @@ namespace dnac {
 
 using sc::Status;
 using trio::BoundedIOStream;
+using trio::BufferedStream;
 using trio::FileStream;
 using trio::MemoryMappedFileStream;
 using trio::MemoryStream;
+using dna::ByteOrder;
 using dna::DataLayer;
 using dna::BinaryStreamReader;
 using dna::BinaryStreamWriter;
 using dna::JSONStreamReader;
 using dna::JSONStreamWriter;
+using dna::LazyBinaryStreamReader;
+using dna::MemoryReport;
+using dna::MeshMemoryReport;
+using dna::ReadMode;
 using dna::StreamReader;
 using dna::StreamWriter;
 using dna::StringView;
@@ -12,9 +12,25 @@ namespace pma {
 
 /**
     @brief Serves allocations from a preallocated memory region.
+    @note
+        Memory is reclaimed only as a whole, either by rewinding the arena to a previously taken marker, or by resetting it.
+        The memory regions themselves are kept in both cases, and are reused by subsequent allocations, so an arena that
+        has grown large enough once, serves all subsequent allocations without allocating from the upstream memory resource.
     @see MemoryResource
 */
 class ArenaMemoryResource : public MemoryResource {
+    public:
+        /**
+            @brief Position in the arena up to which memory is allocated.
+            @see mark
+            @see release
+        */
+        struct Marker {
+            std::size_t region;
+            std::size_t offset;
+            std::size_t usedSize;
+        };
+
     public:
         /**
             @brief Constructor
@@ -83,6 +99,41 @@ class ArenaMemoryResource : public MemoryResource {
             @brief The upstream memory resource was passed through the constructor and is backing all arena allocations.
         */
         PMAAPI MemoryResource* getUpstreamMemoryResource() const;
+        /**
+            @brief Marks the position in the arena up to which memory is currently allocated.
+            @see release
+        */
+        PMAAPI Marker mark() const;
+        /**
+            @brief Rewinds the arena to the given marker, freeing all allocations made since the marker was taken.
+            @note
+                The memory regions are kept, and are reused by subsequent allocations.
+            @warning
+                The marker must have been taken from this arena, and must not be past the current position in it,
+                i.e. after rewinding to a marker, all markers taken after it are invalidated.
+            @param marker
+                The marker as returned by mark.
+            @see mark
+        */
+        PMAAPI void release(const Marker& marker);
+        /**
+            @brief Frees all allocations at once, rewinding the arena to its beginning.
+            @note
+                The memory regions are kept, and are reused by subsequent allocations.
+        */
+        PMAAPI void reset();
+        /**
+            @brief The number of bytes currently allocated from the arena, including alignment padding.
+        */
+        PMAAPI std::size_t getUsedSize() const;
+        /**
+            @brief The highest number of bytes allocated from the arena at once, since it was created.
+        */
+        PMAAPI std::size_t getPeakUsedSize() const;
+        /**
+            @brief The combined size of all memory regions allocated from the upstream memory resource.
+        */
+        PMAAPI std::size_t getReservedSize() const;
 
     private:
         class Impl;
@@ -0,0 +1,83 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "pma/Defs.h"
+#include "pma/MemoryResource.h"
+#include "pma/ScopedPtr.h"
+
+#include <cstddef>
+
+namespace pma {
+
+/**
+    @brief Serves small allocations from pools of equally sized blocks, that are reused once deallocated.
+    @note
+        Allocation sizes are rounded up to the nearest power of two (the size class), and each size class has its own pool
+        of blocks, carved out of larger chunks allocated from the upstream memory resource. Blocks are aligned to their
+        size, so alignment requirements up to the block size are met as well.
+        Allocations larger than the largest size class are passed through to the upstream memory resource.
+        The pools are split into multiple caches, and threads are distributed among them, so threads allocating
+        concurrently rarely contend for the same cache. Deallocated blocks are returned to the cache of the
+        deallocating thread, and once a cache holds more than two chunks worth of free blocks of a size class, the
+        excess is handed over to a list shared by all caches, which caches draw from before allocating new chunks.
+        So blocks allocated by one thread and deallocated by another are reused, instead of piling up in the cache
+        of the deallocating thread. Chunks are freed only when the pool itself is destroyed.
+    @note
+        The pool itself is thread-safe, while the upstream memory resource is accessed concurrently only if multiple
+        threads need to allocate new chunks at the same time.
+    @see MemoryResource
+*/
+class PoolMemoryResource : public MemoryResource {
+    public:
+        /**
+            @brief Constructor
+            @param maxBlockSize
+                The size of the largest size class, allocations larger than this are served by the upstream memory
+                resource. It is rounded up to a power of two.
+            @param chunkSize
+                The size of chunks allocated from the upstream memory resource, out of which the blocks of a size class
+                are carved. Chunks always hold at least one block.
+            @param upstream
+                The memory resource from which chunks and allocations larger than the largest size class are allocated.
+        */
+        PMAAPI PoolMemoryResource(std::size_t maxBlockSize, std::size_t chunkSize, MemoryResource* upstream);
+        /**
+            @brief Constructor
+            @param upstream
+                The memory resource from which chunks and allocations larger than the largest size class are allocated.
+            @note
+                Blocks of up to 4KB are pooled, in chunks of 64KB.
+        */
+        PMAAPI explicit PoolMemoryResource(MemoryResource* upstream);
+
+        PMAAPI ~PoolMemoryResource();
+
+        PoolMemoryResource(const PoolMemoryResource&) = delete;
+        PoolMemoryResource& operator=(const PoolMemoryResource&) = delete;
+
+        PMAAPI PoolMemoryResource(PoolMemoryResource&&);
+        PMAAPI PoolMemoryResource& operator=(PoolMemoryResource&&);
+
+        /**
+            @brief Allocations are served from the pool of the matching size class, from the cache of the calling thread.
+        */
+        PMAAPI void* allocate(std::size_t size, std::size_t alignment) override;
+        /**
+            @brief The block is returned into the pool of the matching size class, to be reused by subsequent allocations.
+            @warning
+                The size and alignment must be the same as were used for the allocation.
+        */
+        PMAAPI void deallocate(void* ptr, std::size_t size, std::size_t alignment) override;
+        /**
+            @brief The upstream memory resource was passed through the constructor and is backing all pool allocations.
+        */
+        PMAAPI MemoryResource* getUpstreamMemoryResource() const;
+
+    private:
+        class Impl;
+        ScopedPtr<Impl, FactoryDestroy<Impl> > pImpl;
+
+};
+
+}  // namespace pma
@@ -0,0 +1,143 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "pma/Defs.h"
+#include "pma/MemoryResource.h"
+#include "pma/ScopedPtr.h"
+
+#include <cstddef>
+
+namespace pma {
+
+/**
+    @brief Tags all allocations made by the calling thread while it exists, for accounting by TrackingMemoryResource.
+    @note
+        Tags nest, so allocations are attributed to the path of all currently existing tags of the thread, separated
+        by slashes, e.g. allocations made while the tags "geometry" and "mesh[2]" exist are attributed to
+        "geometry/mesh[2]", which is itself accounted as part of "geometry".
+    @note
+        Tags apply to all instances of TrackingMemoryResource. While no instance exists, tags are not recorded at all,
+        so they cost next to nothing, which also means that a tag created before any instance existed is never part
+        of the tag path.
+    @see TrackingMemoryResource
+*/
+class ScopedAllocationTag {
+    public:
+        /**
+            @brief Constructor
+            @param tag
+                The tag to be appended to the tag path of the calling thread.
+        */
+        PMAAPI explicit ScopedAllocationTag(const char* tag);
+        /**
+            @brief Constructor
+            @param tag
+                The tag to be appended to the tag path of the calling thread, followed by the given index in brackets.
+            @param index
+                The index of the tagged element, e.g. the index of a mesh.
+        */
+        PMAAPI ScopedAllocationTag(const char* tag, std::size_t index);
+        /**
+            @brief Removes the tag from the tag path of the calling thread.
+        */
+        PMAAPI ~ScopedAllocationTag();
+
+        ScopedAllocationTag(const ScopedAllocationTag&) = delete;
+        ScopedAllocationTag& operator=(const ScopedAllocationTag&) = delete;
+
+        ScopedAllocationTag(ScopedAllocationTag&&) = delete;
+        ScopedAllocationTag& operator=(ScopedAllocationTag&&) = delete;
+
+    private:
+        std::size_t previousLength;
+        bool recorded;
+
+};
+
+/**
+    @brief Passes all allocations through to an upstream memory resource, while accounting them per tag.
+    @note
+        Each allocation is attributed to the tag path of the allocating thread at the time of allocation, and to all
+        of its enclosing tags, so the statistics of a tag include those of all tags nested within it. Deallocations
+        are attributed to the same tags as the allocations they free, regardless of which thread deallocates.
+    @note
+        The tracking resource is thread-safe, while the upstream memory resource is accessed concurrently if multiple
+        threads allocate at the same time.
+    @see ScopedAllocationTag
+    @see MemoryResource
+*/
+class TrackingMemoryResource : public MemoryResource {
+    public:
+        struct Statistics {
+            // Number of bytes currently allocated
+            std::size_t usedBytes;
+            // Highest number of bytes that were allocated at once
+            std::size_t peakUsedBytes;
+            // Number of bytes allocated over time, including those already deallocated
+            std::size_t totalAllocatedBytes;
+            std::size_t allocationCount;
+            std::size_t deallocationCount;
+        };
+
+    public:
+        /**
+            @brief Constructor
+            @param upstream
+                The memory resource through which all allocations are served, and also the bookkeeping of the tracking
+                resource itself, which is not accounted.
+        */
+        PMAAPI explicit TrackingMemoryResource(MemoryResource* upstream);
+
+        PMAAPI ~TrackingMemoryResource();
+
+        TrackingMemoryResource(const TrackingMemoryResource&) = delete;
+        TrackingMemoryResource& operator=(const TrackingMemoryResource&) = delete;
+
+        PMAAPI TrackingMemoryResource(TrackingMemoryResource&&);
+        PMAAPI TrackingMemoryResource& operator=(TrackingMemoryResource&&);
+
+        PMAAPI void* allocate(std::size_t size, std::size_t alignment) override;
+        PMAAPI void deallocate(void* ptr, std::size_t size, std::size_t alignment) override;
+        /**
+            @brief The upstream memory resource was passed through the constructor and is serving all allocations.
+        */
+        PMAAPI MemoryResource* getUpstreamMemoryResource() const;
+        /**
+            @brief Statistics of all allocations, regardless of their tags.
+        */
+        PMAAPI Statistics getStatistics() const;
+        /**
+            @brief Statistics of allocations attributed to the given tag path, including those of all nested tags.
+            @param tag
+                The tag path, e.g. "geometry/mesh[2]".
+            @return
+                Statistics of the tag path, all zeros if no allocations were attributed to it.
+        */
+        PMAAPI Statistics getStatistics(const char* tag) const;
+        /**
+            @brief Number of distinct tag paths to which allocations were attributed.
+        */
+        PMAAPI std::size_t getTagCount() const;
+        /**
+            @brief The tag path at the given index, in the order in which tag paths were first encountered.
+            @param index
+                A value between 0 and getTagCount() - 1.
+            @warning
+                The returned pointer is valid as long as the tracking resource exists.
+        */
+        PMAAPI const char* getTag(std::size_t index) const;
+        /**
+            @brief Statistics of the tag path at the given index, including those of all nested tags.
+            @param index
+                A value between 0 and getTagCount() - 1.
+        */
+        PMAAPI Statistics getTagStatistics(std::size_t index) const;
+
+    private:
+        class Impl;
+        ScopedPtr<Impl, FactoryDestroy<Impl> > pImpl;
+
+};
+
+}  // namespace pma
@@ -155,4 +155,26 @@ class TRIOAPI Resizable {
 
 };
 
+class TRIOAPI Mappable {
+    public:
+        /**
+            @brief Obtain direct access to a region of the stream's contents.
+            @param position
+                Position in the stream relative to it's start, where the region begins.
+            @param size
+                Number of bytes the region spans.
+            @return
+                Pointer to the first byte of the region, or nullptr if the region is not directly accessible.
+            @note
+                The region is read-only (e.g. it may be mapped without write access), so it must not be modified.
+            @warning
+                The returned pointer is valid only until the stream is closed.
+        */
+        virtual const char* view(std::uint64_t position, std::size_t size) = 0;
+
+    protected:
+        virtual ~Mappable();
+
+};
+
 }  // namespace trio
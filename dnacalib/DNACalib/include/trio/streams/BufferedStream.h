@@ -0,0 +1,84 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "trio/Defs.h"
+#include "trio/Stream.h"
+
+#include <cstddef>
+
+namespace trio {
+
+/**
+    @brief Stream decorator that buffers reads from and writes into another stream.
+    @note
+        Small reads and writes are served from an internal buffer, so the underlying stream is accessed only
+        in buffer sized blocks, while reads and writes larger than the buffer are passed through directly.
+        Seeking within the currently buffered region does not access the underlying stream at all.
+    @warning
+        Written data reaches the underlying stream only when the buffer is flushed, which happens implicitly
+        on close, or explicitly by calling flush.
+*/
+class TRIOAPI BufferedStream : public BoundedIOStream, public Buffered {
+    public:
+        /**
+            @brief Factory method for creation of a BufferedStream instance.
+            @param stream
+                The stream to be buffered.
+            @param memRes
+                The memory resource to be used for the allocation of the BufferedStream instance and its buffer.
+            @note
+                If a custom memory resource is not given, a default allocation mechanism will be used.
+            @warning
+                User is responsible for releasing the returned pointer by calling destroy.
+            @see destroy
+        */
+        static BufferedStream* create(BoundedIOStream* stream, MemoryResource* memRes = nullptr);
+        /**
+            @brief Factory method for creation of a BufferedStream instance.
+            @param stream
+                The stream to be buffered.
+            @param bufferSize
+                Size of the internal buffer in bytes.
+            @param memRes
+                The memory resource to be used for the allocation of the BufferedStream instance and its buffer.
+            @note
+                If a custom memory resource is not given, a default allocation mechanism will be used.
+            @warning
+                User is responsible for releasing the returned pointer by calling destroy.
+            @see destroy
+        */
+        static BufferedStream* create(BoundedIOStream* stream, std::size_t bufferSize, MemoryResource* memRes = nullptr);
+        /**
+            @brief Method for freeing a BufferedStream instance.
+            @param instance
+                Instance of BufferedStream to be freed.
+            @see create
+        */
+        static void destroy(BufferedStream* instance);
+
+        BufferedStream() = default;
+        ~BufferedStream() override;
+
+        BufferedStream(const BufferedStream&) = delete;
+        BufferedStream& operator=(const BufferedStream&) = delete;
+
+        BufferedStream(BufferedStream&&) = default;
+        BufferedStream& operator=(BufferedStream&&) = default;
+};
+
+}  // namespace trio
+
+namespace pma {
+
+template<>
+struct DefaultInstanceCreator<trio::BufferedStream> {
+    using type = FactoryCreate<trio::BufferedStream>;
+};
+
+template<>
+struct DefaultInstanceDestroyer<trio::BufferedStream> {
+    using type = FactoryDestroy<trio::BufferedStream>;
+};
+
+}  // namespace pma
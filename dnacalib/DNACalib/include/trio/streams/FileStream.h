@@ -5,6 +5,8 @@
 #include "trio/Defs.h"
 #include "trio/Stream.h"
 
+#include <cstddef>
+
 namespace trio {
 
 /**
@@ -29,6 +31,36 @@ class TRIOAPI FileStream : public BoundedIOStream {
             @see destroy
         */
         static FileStream* create(const char* path, AccessMode accessMode, OpenMode openMode, MemoryResource* memRes = nullptr);
+        /**
+            @brief Factory method for creation of a FileStream instance that accesses the file through the native file API.
+            @param path
+                UTF-8 encoded path to file to be opened.
+            @param accessMode
+                Control whether the file is opened for reading or writing.
+            @param openMode
+                Control whether the file is opened in binary or textual mode.
+            @param transferSize
+                The size in bytes of the blocks in which the file is read and written (if zero, a default of 4MB is used).
+            @note
+                Where available (on POSIX platforms), the file is accessed through positional reads and writes on the raw
+                file descriptor, and the operating system is advised that the file is going to be accessed sequentially,
+                which enables more aggressive read-ahead. Small reads and writes are served from an internal buffer of
+                the transfer size, so the file itself is accessed only in large requests, while reads and writes larger
+                than the buffer are passed through directly.
+                Where not available, the returned stream is the same as the one created without specifying the transfer size.
+            @param memRes
+                The memory resource to be used for the allocation of the FileStream instance.
+            @note
+                If a custom memory resource is not given, a default allocation mechanism will be used.
+            @warning
+                User is responsible for releasing the returned pointer by calling destroy.
+            @see destroy
+        */
+        static FileStream* create(const char* path,
+                                  AccessMode accessMode,
+                                  OpenMode openMode,
+                                  std::size_t transferSize,
+                                  MemoryResource* memRes = nullptr);
         /**
             @brief Method for freeing a FileStream instance.
             @param instance
@@ -11,9 +11,27 @@ namespace trio {
 
 /**
     @brief Memory mapped file stream.
+    @note
+        Streams opened with AccessMode::Read are mapped read-only, and if the whole file could be mapped at once,
+        they also grant read-only access to the mapped contents through the Mappable interface. Views obtained that
+        way stay valid until the stream is closed.
 */
-class TRIOAPI MemoryMappedFileStream : public BoundedIOStream, public Buffered, public Resizable {
+class TRIOAPI MemoryMappedFileStream : public BoundedIOStream, public Buffered, public Resizable, public Mappable {
     public:
+        /**
+            @brief Hint about how the contents of a read-only mapping are going to be accessed.
+        */
+        enum class MappingPolicy {
+            /** No hint is given, pages are loaded on demand as they are accessed. */
+            Default,
+            /** The contents are expected to be read sequentially, so aggressive read-ahead is enabled. */
+            Sequential,
+            /** The contents are expected to be accessed soon, so they are read in the background in advance. */
+            WillNeed,
+            /** All contents are read and the page tables populated while the file is being opened. */
+            Populate
+        };
+
         /**
             @brief Factory method for creation of a MemoryMappedFileStream instance.
             @param path
@@ -29,6 +47,34 @@ class TRIOAPI MemoryMappedFileStream : public BoundedIOStream, public Buffered,
             @see destroy
         */
         static MemoryMappedFileStream* create(const char* path, AccessMode accessMode, MemoryResource* memRes = nullptr);
+        /**
+            @brief Factory method for creation of a MemoryMappedFileStream instance that maps the whole file at once.
+            @param path
+                UTF-8 encoded path to file to be opened.
+            @param accessMode
+                Control whether the file is opened for reading or writing.
+            @param mappingPolicy
+                Hint about how the mapped contents are going to be accessed.
+            @param hugePageAlignment
+                Control whether the mapping is aligned to the huge page size, so the operating system may back it with huge pages.
+            @param memRes
+                The memory resource to be used for the allocation of the MemoryMappedFileStream instance.
+            @note
+                Streams opened with AccessMode::Read map the whole file once when opened, and are never remapped while
+                seeking or reading. If the whole file cannot be mapped, opening the stream fails.
+                The mapping policy and huge page alignment are applied only where supported (on POSIX platforms),
+                elsewhere the returned stream is the same as the one created without them.
+            @note
+                If a custom memory resource is not given, a default allocation mechanism will be used.
+            @warning
+                User is responsible for releasing the returned pointer by calling destroy.
+            @see destroy
+        */
+        static MemoryMappedFileStream* create(const char* path,
+                                              AccessMode accessMode,
+                                              MappingPolicy mappingPolicy,
+                                              bool hugePageAlignment = false,
+                                              MemoryResource* memRes = nullptr);
         /**
             @brief Method for freeing a MemoryMappedFileStream instance.
             @param instance
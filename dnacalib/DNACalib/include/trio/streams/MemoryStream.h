@@ -5,6 +5,7 @@
 #include "trio/Defs.h"
 #include "trio/Stream.h"
 
+#include <cstddef>
 #include <cstdint>
 
 namespace trio {
@@ -38,6 +39,26 @@ class TRIOAPI MemoryStream : public BoundedIOStream {
             @see destroy
         */
         static MemoryStream* create(std::size_t initialSize, MemoryResource* memRes = nullptr);
+        /**
+            @brief Factory method for creation of a read-only MemoryStream instance over an existing buffer.
+            @param buffer
+                The buffer from which the stream reads.
+            @param size
+                Size of the buffer in bytes.
+            @param memRes
+                The memory resource to be used for the allocation of the MemoryStream instance.
+            @note
+                The contents of the buffer are not copied, the stream reads them directly from the given buffer.
+                Writing into the stream is not possible, and fails with WriteError.
+            @note
+                If a custom memory resource is not given, a default allocation mechanism will be used.
+            @warning
+                The buffer is not owned by the stream, so it must outlive it.
+            @warning
+                User is responsible for releasing the returned pointer by calling destroy.
+            @see destroy
+        */
+        static MemoryStream* createView(const char* buffer, std::size_t size, MemoryResource* memRes = nullptr);
         /**
             @brief Method for freeing a MemoryStream instance.
             @param instance
@@ -0,0 +1,25 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "dna/TypeDefs.h"
+
+namespace dna {
+
+class Reader;
+
+// Implemented by the built-in Writers, which have direct access to their data, so Writer::setFrom can copy whole arrays
+// at once instead of element by element through the setters of the Writer.
+// Each function must leave the Writer in the same state as copying element by element would.
+class ArrayCopyingWriter {
+    public:
+        virtual ~ArrayCopyingWriter() = default;
+
+        virtual void copyDefinitionFrom(const Reader* source, MemoryResource* memRes) = 0;
+        // Meshes of the Writer are cleared before, and it's called only if the Reader actually contains geometry
+        virtual void copyGeometryFrom(const Reader* source, MemoryResource* memRes) = 0;
+        // Called only if the Reader actually contains blend shape targets
+        virtual void copyBlendShapeTargetsFrom(const Reader* source, MemoryResource* memRes) = 0;
+};
+
+}  // namespace dna
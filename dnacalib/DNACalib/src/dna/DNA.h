@@ -7,6 +7,7 @@
 #include "dna/TypeDefs.h"
 
 #include <terse/types/ArchiveOffset.h>
+#include <terse/types/Transparent.h>
 
 #ifdef _MSC_VER
     #pragma warning(push)
@@ -17,6 +18,7 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <tuple>
@@ -26,6 +28,21 @@
 
 namespace dna {
 
+// Number of bytes occupied by the elements of the given container, excluding any unused capacity
+template<class TContainer>
+inline std::size_t dataSizeOf(const TContainer& container) {
+    return container.size() * sizeof(typename TContainer::value_type);
+}
+
+template<typename T>
+inline std::size_t dataSizeOf(const Matrix<T>& matrix) {
+    std::size_t size = 0ul;
+    for (const auto& row : matrix) {
+        size += dataSizeOf(row);
+    }
+    return size;
+}
+
 template<typename TFrom, typename TTo = TFrom>
 struct RawSurjectiveMapping : public SurjectiveMapping<TFrom, TTo> {
     using SurjectiveMapping<TFrom, TTo>::SurjectiveMapping;
@@ -38,6 +55,16 @@ struct RawSurjectiveMapping : public SurjectiveMapping<TFrom, TTo> {
         archive(this->to);
     }
 
+    std::size_t dataSize() const {
+        return dataSizeOf(this->from) + dataSizeOf(this->to);
+    }
+
+    // Same as RawLODMapping::swap
+    void swap(Vector<TFrom>& from_, Vector<TTo>& to_) {
+        this->from.swap(from_);
+        this->to.swap(to_);
+    }
+
 };
 
 template<typename T>
@@ -105,7 +132,36 @@ struct Version {
     }
 
     bool matches() const {
-        return (generation.matches() && version.matches());
+        // Later versions within a generation only extend the format, so earlier versions remain readable too
+        return (generation.matches() && (version.got != 0u) && (version.got <= version.expected));
+    }
+
+};
+
+struct RawLayout {
+    // The version which stores the layout (right after the version itself), the random access index and string tables
+    // as represented in memory, while earlier versions store everything in network byte order, string by string
+    static constexpr std::uint16_t version = 2u;
+
+    static constexpr std::uint8_t bigEndian = 0u;
+    static constexpr std::uint8_t littleEndian = 1u;
+
+    // Byte order of all data following it, while the signature, version and the byte order itself are always
+    // stored in network byte order. Arrays are also padded to the alignment of the storage they are loaded into
+    // (at least that of their elements), so mapped streams can be borrowed from in place.
+    std::uint8_t byteOrder;
+    // Position of the random access index (zero if there is none)
+    terse::ArchiveOffset<std::uint32_t> index;
+
+    RawLayout() : byteOrder{bigEndian}, index{} {
+    }
+
+    template<class Archive>
+    void serialize(Archive& archive) {
+        archive.label("byteOrder");
+        archive(byteOrder);
+        archive.label("index");
+        archive(index);
     }
 
 };
@@ -170,6 +226,17 @@ struct RawLODMapping : public LODMapping {
         archive(indices);
     }
 
+    std::size_t dataSize() const {
+        return dataSizeOf(lods) + dataSizeOf(indices);
+    }
+
+    // Exchanges the contents of the mapping with the given containers (which must use the same memory resource), so
+    // mappings can be handed over between the DNA structures of the dna and dnacalib libraries without copying
+    void swap(Vector<std::uint16_t>& lods_, Matrix<std::uint16_t>& indices_) {
+        lods.swap(lods_);
+        indices.swap(indices_);
+    }
+
 };
 
 struct RawDescriptor {
@@ -298,6 +365,10 @@ struct RawVector3Vector {
         zs.clear();
     }
 
+    std::size_t dataSize() const {
+        return dataSizeOf(xs) + dataSizeOf(ys) + dataSizeOf(zs);
+    }
+
     template<typename Iterator>
     void assign(Iterator start, Iterator end) {
         reserve(static_cast<std::size_t>(std::distance(start, end)));
@@ -311,18 +382,162 @@ struct RawVector3Vector {
 
 };
 
+// Strings stored one after another in a single array of characters, each followed by a null terminator, so that
+// any number of strings is held by just two allocations
+struct RawStringTable {
+    Vector<char> characters;
+    // Position of the first character of each string, followed by the total number of characters
+    Vector<std::uint32_t> offsets;
+
+    explicit RawStringTable(MemoryResource* memRes) :
+        characters{memRes},
+        offsets{memRes} {
+    }
+
+    // Strings are stored one by one in earlier versions, so archives without dedicated support for this representation
+    // go through the representation in which they were stored there
+    template<class Archive>
+    void load(Archive& archive) {
+        Vector<String<char> > strings{getMemoryResource()};
+        archive(strings);
+        clear();
+        for (const auto& string : strings) {
+            push_back(string.data(), string.size());
+        }
+    }
+
+    template<class Archive>
+    void save(Archive& archive) {
+        Vector<String<char> > strings{getMemoryResource()};
+        strings.reserve(size());
+        for (std::size_t i = 0ul; i < size(); ++i) {
+            const auto string = (*this)[i];
+            strings.emplace_back(string.data(), string.size());
+        }
+        archive(strings);
+    }
+
+    std::size_t size() const {
+        return (offsets.empty() ? 0ul : offsets.size() - 1ul);
+    }
+
+    bool empty() const {
+        return (size() == 0ul);
+    }
+
+    void clear() {
+        characters.clear();
+        offsets.clear();
+    }
+
+    std::size_t dataSize() const {
+        return dataSizeOf(characters) + dataSizeOf(offsets);
+    }
+
+    // The returned view excludes the null terminator, which however follows it, so its data is usable as a C string
+    StringView operator[](std::size_t index) const {
+        assert(index < size());
+        return {characters.data() + offsets[index], offsets[index + 1ul] - offsets[index] - 1ul};
+    }
+
+    void push_back(const char* string, std::size_t length) {
+        if (offsets.empty()) {
+            offsets.push_back(0u);
+        }
+        characters.insert(characters.end(), string, string + length);
+        characters.push_back('\0');
+        offsets.push_back(static_cast<std::uint32_t>(characters.size()));
+    }
+
+    // Strings are added empty, or removed from the end
+    void resize(std::size_t size_) {
+        if (size_ == 0ul) {
+            clear();
+            return;
+        }
+        if (size_ < size()) {
+            offsets.resize(size_ + 1ul);
+            characters.resize(offsets.back());
+        }
+        while (size() < size_) {
+            push_back(nullptr, 0ul);
+        }
+    }
+
+    void set(std::size_t index, const char* string, std::size_t length) {
+        const std::less<const char*> before;
+        if (!characters.empty() && !before(string, characters.data()) &&
+            before(string, characters.data() + characters.size())) {
+            // The source is a string of this table, which may be moved while making room for it
+            const String<char> copy{string, length, getMemoryResource()};
+            set(index, copy.data(), copy.size());
+            return;
+        }
+        if (size() <= index) {
+            resize(index + 1ul);
+        }
+        const std::size_t start = offsets[index];
+        const std::size_t oldLength = offsets[index + 1ul] - start - 1ul;
+        const auto first = std::next(characters.begin(), static_cast<std::ptrdiff_t>(start));
+        if (length > oldLength) {
+            characters.insert(std::next(first, static_cast<std::ptrdiff_t>(oldLength)), length - oldLength, '\0');
+        } else if (length < oldLength) {
+            characters.erase(std::next(first, static_cast<std::ptrdiff_t>(length)), std::next(first, static_cast<std::ptrdiff_t>(oldLength)));
+        }
+        std::copy(string, string + length, std::next(characters.begin(), static_cast<std::ptrdiff_t>(start)));
+        if (length != oldLength) {
+            // Strings that follow are moved by the difference in length
+            for (std::size_t i = index + 1ul; i < offsets.size(); ++i) {
+                offsets[i] = static_cast<std::uint32_t>(offsets[i] - oldLength + length);
+            }
+        }
+    }
+
+    // Keeps only the strings for which the predicate, called with each string and its index, returns true
+    template<typename TPredicate>
+    void filter(TPredicate predicate) {
+        std::size_t keptCount = 0ul;
+        std::uint32_t end = 0u;
+        for (std::size_t i = 0ul; i < size(); ++i) {
+            const std::uint32_t start = offsets[i];
+            const std::uint32_t next = offsets[i + 1ul];
+            if (predicate((*this)[i], i)) {
+                // Strings are only ever moved towards the beginning, over those that were removed
+                std::copy(std::next(characters.begin(), static_cast<std::ptrdiff_t>(start)),
+                          std::next(characters.begin(), static_cast<std::ptrdiff_t>(next)),
+                          std::next(characters.begin(), static_cast<std::ptrdiff_t>(end)));
+                offsets[keptCount] = end;
+                end += next - start;
+                ++keptCount;
+            }
+        }
+        if (keptCount == 0ul) {
+            clear();
+            return;
+        }
+        offsets.resize(keptCount + 1ul);
+        offsets[keptCount] = end;
+        characters.resize(end);
+    }
+
+    MemoryResource* getMemoryResource() const {
+        return characters.get_allocator().getMemoryResource();
+    }
+
+};
+
 struct RawDefinition {
     terse::ArchiveOffset<std::uint32_t>::Proxy marker;
     RawLODMapping lodJointMapping;
     RawLODMapping lodBlendShapeMapping;
     RawLODMapping lodAnimatedMapMapping;
     RawLODMapping lodMeshMapping;
-    Vector<String<char> > guiControlNames;
-    Vector<String<char> > rawControlNames;
-    Vector<String<char> > jointNames;
-    Vector<String<char> > blendShapeChannelNames;
-    Vector<String<char> > animatedMapNames;
-    Vector<String<char> > meshNames;
+    RawStringTable guiControlNames;
+    RawStringTable rawControlNames;
+    RawStringTable jointNames;
+    RawStringTable blendShapeChannelNames;
+    RawStringTable animatedMapNames;
+    RawStringTable meshNames;
     RawSurjectiveMapping<std::uint16_t> meshBlendShapeChannelMapping;
     DynArray<std::uint16_t> jointHierarchy;
     RawVector3Vector neutralJointTranslations;
@@ -358,17 +573,17 @@ struct RawDefinition {
         archive.label("lodMeshMapping");
         archive(lodMeshMapping);
         archive.label("guiControlNames");
-        archive(guiControlNames);
+        archive(terse::transparent(guiControlNames));
         archive.label("rawControlNames");
-        archive(rawControlNames);
+        archive(terse::transparent(rawControlNames));
         archive.label("jointNames");
-        archive(jointNames);
+        archive(terse::transparent(jointNames));
         archive.label("blendShapeChannelNames");
-        archive(blendShapeChannelNames);
+        archive(terse::transparent(blendShapeChannelNames));
         archive.label("animatedMapNames");
-        archive(animatedMapNames);
+        archive(terse::transparent(animatedMapNames));
         archive.label("meshNames");
-        archive(meshNames);
+        archive(terse::transparent(meshNames));
         archive.label("meshBlendShapeChannelMapping");
         archive(meshBlendShapeChannelMapping);
         archive.label("jointHierarchy");
@@ -414,6 +629,11 @@ struct RawConditionalTable {
         archive(cutValues);
     }
 
+    std::size_t dataSize() const {
+        return dataSizeOf(inputIndices) + dataSizeOf(outputIndices) + dataSizeOf(fromValues) + dataSizeOf(toValues) +
+            dataSizeOf(slopeValues) + dataSizeOf(cutValues);
+    }
+
 };
 
 struct RawPSDMatrix {
@@ -437,6 +657,10 @@ struct RawPSDMatrix {
         archive(values);
     }
 
+    std::size_t dataSize() const {
+        return dataSizeOf(rows) + dataSizeOf(columns) + dataSizeOf(values);
+    }
+
 };
 
 struct RawControls {
@@ -500,6 +724,11 @@ struct RawJointGroup {
         archive(jointIndices);
     }
 
+    std::size_t dataSize() const {
+        return dataSizeOf(lods) + dataSizeOf(inputIndices) + dataSizeOf(outputIndices) + dataSizeOf(values) +
+            dataSizeOf(jointIndices);
+    }
+
 };
 
 struct RawJoints {
@@ -644,6 +873,10 @@ struct RawTextureCoordinateVector {
         vs.clear();
     }
 
+    std::size_t dataSize() const {
+        return dataSizeOf(us) + dataSizeOf(vs);
+    }
+
 };
 
 struct RawVertexLayoutVector {
@@ -678,6 +911,85 @@ struct RawVertexLayoutVector {
         normals.clear();
     }
 
+    std::size_t dataSize() const {
+        return dataSizeOf(positions) + dataSizeOf(textureCoordinates) + dataSizeOf(normals);
+    }
+
+};
+
+// Variable length arrays, with the values of all arrays stored one after another in a single array
+template<typename T>
+struct RawJaggedArray {
+    Vector<T> values;
+    // Position of the first value of each array, followed by the total number of values
+    Vector<std::uint32_t> offsets;
+
+    explicit RawJaggedArray(MemoryResource* memRes) :
+        values{memRes},
+        offsets{memRes} {
+    }
+
+    std::size_t size() const {
+        return (offsets.empty() ? 0ul : offsets.size() - 1ul);
+    }
+
+    void clear() {
+        values.clear();
+        offsets.clear();
+    }
+
+    std::size_t dataSize() const {
+        return dataSizeOf(values) + dataSizeOf(offsets);
+    }
+
+    // Arrays are added empty, or removed from the end
+    void resize(std::size_t size_) {
+        if (size_ == 0ul) {
+            clear();
+            return;
+        }
+        if (offsets.empty()) {
+            offsets.push_back(0u);
+        }
+        if (size_ < size()) {
+            offsets.resize(size_ + 1ul);
+            values.resize(offsets.back());
+        }
+        while (size() < size_) {
+            offsets.push_back(offsets.back());
+        }
+    }
+
+    ConstArrayView<T> get(std::size_t index) const {
+        assert(index < size());
+        return {values.data() + offsets[index], offsets[index + 1ul] - offsets[index]};
+    }
+
+    void set(std::size_t index, const T* source, std::size_t count) {
+        if (size() <= index) {
+            resize(index + 1ul);
+        }
+        const std::size_t start = offsets[index];
+        const std::size_t oldCount = offsets[index + 1ul] - start;
+        const auto first = std::next(values.begin(), static_cast<std::ptrdiff_t>(start));
+        if (count > oldCount) {
+            values.insert(std::next(first, static_cast<std::ptrdiff_t>(oldCount)), count - oldCount, T{});
+        } else if (count < oldCount) {
+            values.erase(std::next(first, static_cast<std::ptrdiff_t>(count)), std::next(first, static_cast<std::ptrdiff_t>(oldCount)));
+        }
+        std::copy(source, source + count, std::next(values.begin(), static_cast<std::ptrdiff_t>(start)));
+        if (count != oldCount) {
+            // Arrays that follow are moved by the difference in size
+            for (std::size_t i = index + 1ul; i < offsets.size(); ++i) {
+                offsets[i] = static_cast<std::uint32_t>(offsets[i] - oldCount + count);
+            }
+        }
+    }
+
+    MemoryResource* getMemoryResource() const {
+        return values.get_allocator().getMemoryResource();
+    }
+
 };
 
 struct RawFace {
@@ -695,6 +1007,52 @@ struct RawFace {
 
 };
 
+// Faces of a mesh, with the layout indices of all faces stored in a single array
+struct RawFaceVector {
+    RawJaggedArray<std::uint32_t> layoutIndices;
+
+    explicit RawFaceVector(MemoryResource* memRes) :
+        layoutIndices{memRes} {
+    }
+
+    // Faces are stored one by one, so archives without dedicated support for this representation go through
+    // the representation in which they are stored
+    template<class Archive>
+    void load(Archive& archive) {
+        Vector<RawFace> faces{layoutIndices.getMemoryResource()};
+        archive(faces);
+        clear();
+        for (std::size_t i = 0ul; i < faces.size(); ++i) {
+            layoutIndices.set(i, faces[i].layoutIndices.data(), faces[i].layoutIndices.size());
+        }
+    }
+
+    template<class Archive>
+    void save(Archive& archive) {
+        Vector<RawFace> faces{layoutIndices.getMemoryResource()};
+        faces.reserve(size());
+        for (std::size_t i = 0ul; i < size(); ++i) {
+            const auto face = layoutIndices.get(i);
+            faces.emplace_back(layoutIndices.getMemoryResource());
+            faces.back().layoutIndices.assign(face.begin(), face.end());
+        }
+        archive(faces);
+    }
+
+    std::size_t size() const {
+        return layoutIndices.size();
+    }
+
+    void clear() {
+        layoutIndices.clear();
+    }
+
+    std::size_t dataSize() const {
+        return layoutIndices.dataSize();
+    }
+
+};
+
 struct RawVertexSkinWeights {
     AlignedDynArray<float> weights;
     DynArray<std::uint16_t> jointIndices;
@@ -714,6 +1072,71 @@ struct RawVertexSkinWeights {
 
 };
 
+// Skin weights of all vertices of a mesh, with the weights and joint indices of all vertices stored in
+// a single array each
+struct RawSkinWeightsVector {
+    RawJaggedArray<float> weights;
+    RawJaggedArray<std::uint16_t> jointIndices;
+
+    explicit RawSkinWeightsVector(MemoryResource* memRes) :
+        weights{memRes},
+        jointIndices{memRes} {
+    }
+
+    // Skin weights are stored vertex by vertex, so archives without dedicated support for this representation
+    // go through the representation in which they are stored
+    template<class Archive>
+    void load(Archive& archive) {
+        Vector<RawVertexSkinWeights> skinWeights{weights.getMemoryResource()};
+        archive(skinWeights);
+        clear();
+        for (std::size_t i = 0ul; i < skinWeights.size(); ++i) {
+            setWeights(i, skinWeights[i].weights.data(), skinWeights[i].weights.size());
+            setJointIndices(i, skinWeights[i].jointIndices.data(), skinWeights[i].jointIndices.size());
+        }
+    }
+
+    template<class Archive>
+    void save(Archive& archive) {
+        Vector<RawVertexSkinWeights> skinWeights{weights.getMemoryResource()};
+        skinWeights.reserve(size());
+        for (std::size_t i = 0ul; i < size(); ++i) {
+            const auto vertexWeights = weights.get(i);
+            const auto vertexJointIndices = jointIndices.get(i);
+            skinWeights.emplace_back(weights.getMemoryResource());
+            skinWeights.back().weights.assign(vertexWeights.begin(), vertexWeights.end());
+            skinWeights.back().jointIndices.assign(vertexJointIndices.begin(), vertexJointIndices.end());
+        }
+        archive(skinWeights);
+    }
+
+    std::size_t size() const {
+        assert(weights.size() == jointIndices.size());
+        return weights.size();
+    }
+
+    void clear() {
+        weights.clear();
+        jointIndices.clear();
+    }
+
+    std::size_t dataSize() const {
+        return weights.dataSize() + jointIndices.dataSize();
+    }
+
+    // Both arrays always hold the same number of vertices, even if only one of them is set for some vertex
+    void setWeights(std::size_t vertexIndex, const float* source, std::size_t count) {
+        weights.set(vertexIndex, source, count);
+        jointIndices.resize(std::max(jointIndices.size(), weights.size()));
+    }
+
+    void setJointIndices(std::size_t vertexIndex, const std::uint16_t* source, std::size_t count) {
+        jointIndices.set(vertexIndex, source, count);
+        weights.resize(std::max(weights.size(), jointIndices.size()));
+    }
+
+};
+
 struct RawBlendShapeTarget {
     RawVector3Vector deltas;
     DynArray<std::uint32_t> vertexIndices;
@@ -735,6 +1158,10 @@ struct RawBlendShapeTarget {
         archive(blendShapeChannelIndex);
     }
 
+    std::size_t dataSize() const {
+        return deltas.dataSize() + dataSizeOf(vertexIndices);
+    }
+
 };
 
 struct RawMesh {
@@ -743,9 +1170,9 @@ struct RawMesh {
     RawTextureCoordinateVector textureCoordinates;
     RawVector3Vector normals;
     RawVertexLayoutVector layouts;
-    Vector<RawFace> faces;
+    RawFaceVector faces;
     std::uint16_t maximumInfluencePerVertex;
-    Vector<RawVertexSkinWeights> skinWeights;
+    RawSkinWeightsVector skinWeights;
     Vector<RawBlendShapeTarget> blendShapeTargets;
     terse::ArchiveOffset<std::uint32_t>::Proxy marker;
 
@@ -775,14 +1202,65 @@ struct RawMesh {
         archive.label("layouts");
         archive(layouts);
         archive.label("faces");
-        archive(faces);
+        archive(terse::transparent(faces));
         archive.label("maximumInfluencePerVertex");
         archive(maximumInfluencePerVertex);
         archive.label("skinWeights");
+        archive(terse::transparent(skinWeights));
+        archive.label("blendShapeTargets");
+        archive(blendShapeTargets);
+        archive(marker);
+    }
+
+};
+
+struct RawMeshIndex {
+    std::uint32_t position;
+    std::uint32_t skinWeights;
+    std::uint32_t blendShapeTargets;
+    DynArray<std::uint32_t> blendShapeTargetPositions;
+    DynArray<std::uint16_t> blendShapeChannelIndices;
+
+    explicit RawMeshIndex(MemoryResource* memRes) :
+        position{},
+        skinWeights{},
+        blendShapeTargets{},
+        blendShapeTargetPositions{memRes},
+        blendShapeChannelIndices{memRes} {
+    }
+
+    template<class Archive>
+    void serialize(Archive& archive) {
+        archive.label("position");
+        archive(position);
+        archive.label("skinWeights");
         archive(skinWeights);
         archive.label("blendShapeTargets");
         archive(blendShapeTargets);
+        archive.label("blendShapeTargetPositions");
+        archive(blendShapeTargetPositions);
+        archive.label("blendShapeChannelIndices");
+        archive(blendShapeChannelIndices);
+    }
+
+};
+
+// Stream positions of individual meshes and their parts, stored after all other data, so any of them can be loaded
+// without processing the data preceding them
+struct RawIndex {
+    terse::ArchiveOffset<std::uint32_t>::Proxy marker;
+    Vector<RawMeshIndex> meshes;
+
+    RawIndex(terse::ArchiveOffset<std::uint32_t>& markerTarget, MemoryResource* memRes) :
+        marker{markerTarget},
+        meshes{memRes} {
+    }
+
+    template<class Archive>
+    void serialize(Archive& archive) {
         archive(marker);
+        archive.label("meshes");
+        archive(meshes);
     }
 
 };
@@ -808,13 +1286,15 @@ struct RawGeometry {
 struct DNA {
     MemoryResource* memRes;
     Signature<3> signature{{'D', 'N', 'A'}};
-    Version version{2, 1};
+    Version version{2, RawLayout::version};
+    RawLayout layout;
     SectionLookupTable sections;
     RawDescriptor descriptor;
     RawDefinition definition;
     RawBehavior behavior;
     RawGeometry geometry;
     Signature<3> eof{{'A', 'N', 'D'}};
+    RawIndex index;
 
     explicit DNA(MemoryResource* memRes_) :
         memRes{memRes_},
@@ -827,7 +1307,8 @@ struct DNA {
                  sections.blendShapeChannels,
                  sections.animatedMaps,
                  memRes},
-        geometry{sections.geometry, memRes} {
+        geometry{sections.geometry, memRes},
+        index{layout.index, memRes} {
     }
 
     template<class Archive>
@@ -837,6 +1318,12 @@ struct DNA {
         archive.label("version");
         archive(version);
         if (signature.matches() && version.matches()) {
+            layout.byteOrder = RawLayout::bigEndian;
+            layout.index.value = {};
+            if (version.version.got >= RawLayout::version) {
+                archive.label("layout");
+                archive(layout);
+            }
             archive.label("sections");
             archive(sections);
             archive.label("descriptor");
@@ -850,6 +1337,10 @@ struct DNA {
             archive.label("eof");
             archive(eof);
             assert(eof.matches());
+            if (layout.index.value != 0u) {
+                archive.label("index");
+                archive(index);
+            }
         }
     }
 
@@ -859,6 +1350,10 @@ struct DNA {
         archive(signature);
         archive.label("version");
         archive(version);
+        if (version.version.expected >= RawLayout::version) {
+            archive.label("layout");
+            archive(layout);
+        }
         archive.label("sections");
         archive(sections);
         archive.label("descriptor");
@@ -871,6 +1366,10 @@ struct DNA {
         archive(geometry);
         archive.label("eof");
         archive(eof);
+        if (version.version.expected >= RawLayout::version) {
+            archive.label("index");
+            archive(index);
+        }
     }
 
     void unloadDefinition() {
@@ -885,6 +1384,7 @@ struct DNA {
 
     void unloadGeometry() {
         geometry = RawGeometry{sections.geometry, memRes};
+        index.meshes.clear();
     }
 
 };
@@ -0,0 +1,79 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "dna/TypeDefs.h"
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <mutex>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace dna {
+
+// Finds the internal interface of a built-in implementation through one of its exported interfaces, without relying
+// on RTTI, so functionality can be added to the built-in implementations without changing the exported interfaces.
+// Implementations register themselves for their whole lifetime by holding a Registration member.
+template<class TInterface, class TInternal>
+class ImplementationRegistry {
+    public:
+        class Registration {
+            public:
+                Registration(const TInterface* interface_, TInternal* internal) : interface{interface_} {
+                    ImplementationRegistry::add(interface, internal);
+                }
+
+                ~Registration() {
+                    ImplementationRegistry::remove(interface);
+                }
+
+                Registration(const Registration&) = delete;
+                Registration& operator=(const Registration&) = delete;
+
+                Registration(Registration&&) = delete;
+                Registration& operator=(Registration&&) = delete;
+
+            private:
+                const TInterface* interface;
+        };
+
+    public:
+        // Returns nullptr if the given object is not a registered built-in implementation
+        static TInternal* find(const TInterface* interface) {
+            Registry& registry = instance();
+            std::lock_guard<std::mutex> lock{registry.lock};
+            auto it = registry.entries.find(interface);
+            return (it == registry.entries.end() ? nullptr : it->second);
+        }
+
+    private:
+        struct Registry {
+            std::mutex lock;
+            DefaultMemoryResource memRes;
+            UnorderedMap<const TInterface*, TInternal*> entries{&memRes};
+        };
+
+        static Registry& instance() {
+            // Never destroyed, so implementations which outlive static destruction can still deregister themselves
+            static Registry* registry = new Registry{};
+            return *registry;
+        }
+
+        static void add(const TInterface* interface, TInternal* internal) {
+            Registry& registry = instance();
+            std::lock_guard<std::mutex> lock{registry.lock};
+            registry.entries[interface] = internal;
+        }
+
+        static void remove(const TInterface* interface) {
+            Registry& registry = instance();
+            std::lock_guard<std::mutex> lock{registry.lock};
+            registry.entries.erase(interface);
+        }
+};
+
+}  // namespace dna
@@ -59,6 +59,7 @@ void LODConstraint::applyTo(Vector<std::uint16_t>& unconstrainedLODs) const {
 }
 
 void LODConstraint::applyTo(DynArray<std::uint16_t>& unconstrainedLODs) const {
+    extd::makeOwned(unconstrainedLODs);
     extd::filter(unconstrainedLODs, extd::byPosition(lods));
 }
 
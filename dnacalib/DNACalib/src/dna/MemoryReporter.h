@@ -0,0 +1,27 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "dna/MemoryReport.h"
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <cstdint>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace dna {
+
+// Implemented by the built-in Readers, through which getMemoryReport and getMeshMemoryReport reach their data
+class MemoryReporter {
+    public:
+        virtual ~MemoryReporter() = default;
+
+        virtual MemoryReport getMemoryReport() const = 0;
+        virtual MeshMemoryReport getMeshMemoryReport(std::uint16_t meshIndex) const = 0;
+};
+
+}  // namespace dna
@@ -0,0 +1,99 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "dna/TypeDefs.h"
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace dna {
+
+// Hash index that maps names to their positions in an array of names.
+// Only the positions are stored (in an open addressing table), while names are compared against the array the index
+// is used with, so a position whose name was changed since the index was built is never returned for its old name.
+// The index must however be rebuilt (or reset, to be rebuilt on next use) for such names to be found under their new
+// names, which is done automatically only if the number of names changes.
+class NameIndex {
+    public:
+        static constexpr std::uint16_t notFound = std::numeric_limits<std::uint16_t>::max();
+
+    public:
+        explicit NameIndex(MemoryResource* memRes) : slots{memRes}, nameCount{} {
+        }
+
+        void reset() {
+            slots.clear();
+            nameCount = 0ul;
+        }
+
+        // Finds the position of the first name in the given array that equals the given name, building the index first
+        // if it was not yet built for the array
+        template<class TNames>
+        std::uint16_t find(const TNames& names, const char* name) {
+            if ((name == nullptr) || names.empty()) {
+                return notFound;
+            }
+            if (slots.empty() || (nameCount != names.size())) {
+                build(names);
+            }
+            const std::size_t length = std::strlen(name);
+            const std::size_t mask = slots.size() - 1ul;
+            for (std::size_t slot = hash(name, length) & mask; slots[slot] != notFound; slot = (slot + 1ul) & mask) {
+                const auto position = slots[slot];
+                if ((position < names.size()) && (names[position].size() == length) &&
+                    (std::memcmp(names[position].data(), name, length) == 0)) {
+                    return position;
+                }
+            }
+            return notFound;
+        }
+
+    private:
+        template<class TNames>
+        void build(const TNames& names) {
+            // Kept at most half full, so probe sequences remain short
+            std::size_t slotCount = 16ul;
+            while (slotCount < names.size() * 2ul) {
+                slotCount <<= 1ul;
+            }
+            const std::uint16_t emptySlot = notFound;
+            slots.assign(slotCount, emptySlot);
+            nameCount = names.size();
+
+            const std::size_t mask = slotCount - 1ul;
+            // Positions are inserted in ascending order, so among equal names, the first one is found first
+            for (std::size_t position = 0ul; position < names.size(); ++position) {
+                std::size_t slot = hash(names[position].data(), names[position].size()) & mask;
+                while (slots[slot] != notFound) {
+                    slot = (slot + 1ul) & mask;
+                }
+                slots[slot] = static_cast<std::uint16_t>(position);
+            }
+        }
+
+        static std::size_t hash(const char* name, std::size_t length) {
+            // FNV-1a
+            std::uint32_t result = 2166136261u;
+            for (std::size_t i = 0ul; i < length; ++i) {
+                result = (result ^ static_cast<unsigned char>(name[i])) * 16777619u;
+            }
+            return result;
+        }
+
+    private:
+        Vector<std::uint16_t> slots;
+        std::size_t nameCount;
+
+};
+
+}  // namespace dna
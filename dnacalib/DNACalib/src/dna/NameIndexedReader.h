@@ -0,0 +1,29 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <cstdint>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace dna {
+
+// Implemented by the built-in Readers, through which the get*IndexByName functions reach their name indices
+class NameIndexedReader {
+    public:
+        virtual ~NameIndexedReader() = default;
+
+        virtual std::uint16_t getGUIControlIndexByName(const char* name) const = 0;
+        virtual std::uint16_t getRawControlIndexByName(const char* name) const = 0;
+        virtual std::uint16_t getJointIndexByName(const char* name) const = 0;
+        virtual std::uint16_t getBlendShapeChannelIndexByName(const char* name) const = 0;
+        virtual std::uint16_t getAnimatedMapIndexByName(const char* name) const = 0;
+        virtual std::uint16_t getMeshIndexByName(const char* name) const = 0;
+};
+
+}  // namespace dna
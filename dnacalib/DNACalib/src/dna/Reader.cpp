@@ -2,12 +2,118 @@
 
 #include "dna/Reader.h"
 
+#include "dna/ImplementationRegistry.h"
+#include "dna/MemoryReporter.h"
+#include "dna/NameIndexedReader.h"
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
 namespace dna {
 
+namespace {
+
+using IndexedLookup = std::uint16_t (NameIndexedReader::*)(const char*) const;
+using CountGetter = std::uint16_t (DefinitionReader::*)() const;
+using NameGetter = StringView (DefinitionReader::*)(std::uint16_t) const;
+
+std::uint16_t findIndexByName(const DefinitionReader* reader,
+                              IndexedLookup indexedLookup,
+                              CountGetter getCount,
+                              NameGetter getName,
+                              const char* name) {
+    if ((reader == nullptr) || (name == nullptr)) {
+        return std::numeric_limits<std::uint16_t>::max();
+    }
+    // Built-in Readers look names up in their name index
+    auto nameIndexed = ImplementationRegistry<DefinitionReader, NameIndexedReader>::find(reader);
+    if (nameIndexed != nullptr) {
+        return (nameIndexed->*indexedLookup)(name);
+    }
+    const std::size_t length = std::strlen(name);
+    const std::uint16_t count = (reader->*getCount)();
+    for (std::uint16_t i = 0u; i < count; ++i) {
+        const auto candidate = (reader->*getName)(i);
+        if ((candidate.size() == length) && (std::memcmp(candidate.data(), name, length) == 0)) {
+            return i;
+        }
+    }
+    return std::numeric_limits<std::uint16_t>::max();
+}
+
+}  // namespace
+
 DescriptorReader::~DescriptorReader() = default;
 DefinitionReader::~DefinitionReader() = default;
 BehaviorReader::~BehaviorReader() = default;
 GeometryReader::~GeometryReader() = default;
 Reader::~Reader() = default;
 
+std::uint16_t getGUIControlIndexByName(const DefinitionReader* reader, const char* name) {
+    return findIndexByName(reader,
+                           &NameIndexedReader::getGUIControlIndexByName,
+                           &DefinitionReader::getGUIControlCount,
+                           &DefinitionReader::getGUIControlName,
+                           name);
+}
+
+std::uint16_t getRawControlIndexByName(const DefinitionReader* reader, const char* name) {
+    return findIndexByName(reader,
+                           &NameIndexedReader::getRawControlIndexByName,
+                           &DefinitionReader::getRawControlCount,
+                           &DefinitionReader::getRawControlName,
+                           name);
+}
+
+std::uint16_t getJointIndexByName(const DefinitionReader* reader, const char* name) {
+    return findIndexByName(reader,
+                           &NameIndexedReader::getJointIndexByName,
+                           &DefinitionReader::getJointCount,
+                           &DefinitionReader::getJointName,
+                           name);
+}
+
+std::uint16_t getBlendShapeChannelIndexByName(const DefinitionReader* reader, const char* name) {
+    return findIndexByName(reader,
+                           &NameIndexedReader::getBlendShapeChannelIndexByName,
+                           &DefinitionReader::getBlendShapeChannelCount,
+                           &DefinitionReader::getBlendShapeChannelName,
+                           name);
+}
+
+std::uint16_t getAnimatedMapIndexByName(const DefinitionReader* reader, const char* name) {
+    return findIndexByName(reader,
+                           &NameIndexedReader::getAnimatedMapIndexByName,
+                           &DefinitionReader::getAnimatedMapCount,
+                           &DefinitionReader::getAnimatedMapName,
+                           name);
+}
+
+std::uint16_t getMeshIndexByName(const DefinitionReader* reader, const char* name) {
+    return findIndexByName(reader,
+                           &NameIndexedReader::getMeshIndexByName,
+                           &DefinitionReader::getMeshCount,
+                           &DefinitionReader::getMeshName,
+                           name);
+}
+
+MemoryReport getMemoryReport(const Reader* reader) {
+    auto reporter = ImplementationRegistry<Reader, MemoryReporter>::find(reader);
+    return (reporter == nullptr ? MemoryReport{} : reporter->getMemoryReport());
+}
+
+MeshMemoryReport getMeshMemoryReport(const Reader* reader, std::uint16_t meshIndex) {
+    auto reporter = ImplementationRegistry<Reader, MemoryReporter>::find(reader);
+    return (reporter == nullptr ? MeshMemoryReport{} : reporter->getMeshMemoryReport(meshIndex));
+}
+
 }  // namespace dna
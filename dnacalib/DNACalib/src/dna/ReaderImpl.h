@@ -4,6 +4,9 @@
 
 #include "dna/BaseImpl.h"
 #include "dna/DenormalizedData.h"
+#include "dna/ImplementationRegistry.h"
+#include "dna/MemoryReporter.h"
+#include "dna/NameIndexedReader.h"
 #include "dna/TypeDefs.h"
 
 #ifdef _MSC_VER
@@ -20,7 +23,8 @@
 namespace dna {
 
 template<class TReaderBase>
-class ReaderImpl : public TReaderBase, public virtual BaseImpl {
+class ReaderImpl : public TReaderBase, public dna::MemoryReporter, public dna::NameIndexedReader,
+    public virtual BaseImpl {
     public:
         explicit ReaderImpl(MemoryResource* memRes_);
 
@@ -147,9 +151,25 @@ class ReaderImpl : public TReaderBase, public virtual BaseImpl {
         ConstArrayView<std::uint32_t> getBlendShapeTargetVertexIndices(std::uint16_t meshIndex,
                                                                        std::uint16_t blendShapeTargetIndex) const override;
 
+        // MemoryReporter methods start
+        MemoryReport getMemoryReport() const override;
+        MeshMemoryReport getMeshMemoryReport(std::uint16_t meshIndex) const override;
+
+        // NameIndexedReader methods start
+        std::uint16_t getGUIControlIndexByName(const char* name) const override;
+        std::uint16_t getRawControlIndexByName(const char* name) const override;
+        std::uint16_t getJointIndexByName(const char* name) const override;
+        std::uint16_t getBlendShapeChannelIndexByName(const char* name) const override;
+        std::uint16_t getAnimatedMapIndexByName(const char* name) const override;
+        std::uint16_t getMeshIndexByName(const char* name) const override;
+
     protected:
         mutable DenormalizedData<TReaderBase> cache;
 
+    private:
+        dna::ImplementationRegistry<dna::Reader, dna::MemoryReporter>::Registration memoryReporterRegistration;
+        dna::ImplementationRegistry<dna::DefinitionReader, dna::NameIndexedReader>::Registration nameIndexRegistration;
+
 };
 
 
@@ -158,7 +178,11 @@ class ReaderImpl : public TReaderBase, public virtual BaseImpl {
     #pragma warning(disable : 4589)
 #endif
 template<class TReaderBase>
-inline ReaderImpl<TReaderBase>::ReaderImpl(MemoryResource* memRes_) : BaseImpl{memRes_}, cache{memRes_} {
+inline ReaderImpl<TReaderBase>::ReaderImpl(MemoryResource* memRes_) :
+    BaseImpl{memRes_},
+    cache{memRes_},
+    memoryReporterRegistration{this, this},
+    nameIndexRegistration{this, this} {
 }
 
 #ifdef _MSC_VER
@@ -261,12 +285,16 @@ inline std::uint16_t ReaderImpl<TReaderBase>::getGUIControlCount() const {
 template<class TReaderBase>
 inline StringView ReaderImpl<TReaderBase>::getGUIControlName(std::uint16_t index) const {
     if (index < dna.definition.guiControlNames.size()) {
-        const auto& guiControlName = dna.definition.guiControlNames[index];
-        return {guiControlName.data(), guiControlName.size()};
+        return dna.definition.guiControlNames[index];
     }
     return {};
 }
 
+template<class TReaderBase>
+inline std::uint16_t ReaderImpl<TReaderBase>::getGUIControlIndexByName(const char* name) const {
+    return cache.guiControlNameIndex.find(dna.definition.guiControlNames, name);
+}
+
 template<class TReaderBase>
 inline std::uint16_t ReaderImpl<TReaderBase>::getRawControlCount() const {
     return static_cast<std::uint16_t>(dna.definition.rawControlNames.size());
@@ -275,12 +303,16 @@ inline std::uint16_t ReaderImpl<TReaderBase>::getRawControlCount() const {
 template<class TReaderBase>
 inline StringView ReaderImpl<TReaderBase>::getRawControlName(std::uint16_t index) const {
     if (index < dna.definition.rawControlNames.size()) {
-        const auto& rawControlName = dna.definition.rawControlNames[index];
-        return {rawControlName.data(), rawControlName.size()};
+        return dna.definition.rawControlNames[index];
     }
     return {};
 }
 
+template<class TReaderBase>
+inline std::uint16_t ReaderImpl<TReaderBase>::getRawControlIndexByName(const char* name) const {
+    return cache.rawControlNameIndex.find(dna.definition.rawControlNames, name);
+}
+
 template<class TReaderBase>
 inline std::uint16_t ReaderImpl<TReaderBase>::getJointCount() const {
     return static_cast<std::uint16_t>(dna.definition.jointNames.size());
@@ -289,12 +321,16 @@ inline std::uint16_t ReaderImpl<TReaderBase>::getJointCount() const {
 template<class TReaderBase>
 inline StringView ReaderImpl<TReaderBase>::getJointName(std::uint16_t index) const {
     if (index < dna.definition.jointNames.size()) {
-        const auto& jointName = dna.definition.jointNames[index];
-        return {jointName.data(), jointName.size()};
+        return dna.definition.jointNames[index];
     }
     return {};
 }
 
+template<class TReaderBase>
+inline std::uint16_t ReaderImpl<TReaderBase>::getJointIndexByName(const char* name) const {
+    return cache.jointNameIndex.find(dna.definition.jointNames, name);
+}
+
 template<class TReaderBase>
 inline std::uint16_t ReaderImpl<TReaderBase>::getJointIndexListCount() const {
     return dna.definition.lodJointMapping.getIndexListCount();
@@ -321,12 +357,16 @@ inline std::uint16_t ReaderImpl<TReaderBase>::getBlendShapeChannelCount() const
 template<class TReaderBase>
 inline StringView ReaderImpl<TReaderBase>::getBlendShapeChannelName(std::uint16_t index) const {
     if (index < dna.definition.blendShapeChannelNames.size()) {
-        const auto& blendShapeName = dna.definition.blendShapeChannelNames[index];
-        return {blendShapeName.data(), blendShapeName.size()};
+        return dna.definition.blendShapeChannelNames[index];
     }
     return {};
 }
 
+template<class TReaderBase>
+inline std::uint16_t ReaderImpl<TReaderBase>::getBlendShapeChannelIndexByName(const char* name) const {
+    return cache.blendShapeChannelNameIndex.find(dna.definition.blendShapeChannelNames, name);
+}
+
 template<class TReaderBase>
 inline std::uint16_t ReaderImpl<TReaderBase>::getBlendShapeChannelIndexListCount() const {
     return dna.definition.lodBlendShapeMapping.getIndexListCount();
@@ -345,12 +385,16 @@ inline std::uint16_t ReaderImpl<TReaderBase>::getAnimatedMapCount() const {
 template<class TReaderBase>
 inline StringView ReaderImpl<TReaderBase>::getAnimatedMapName(std::uint16_t index) const {
     if (index < dna.definition.animatedMapNames.size()) {
-        const auto& animatedMapName = dna.definition.animatedMapNames[index];
-        return {animatedMapName.data(), animatedMapName.size()};
+        return dna.definition.animatedMapNames[index];
     }
     return {};
 }
 
+template<class TReaderBase>
+inline std::uint16_t ReaderImpl<TReaderBase>::getAnimatedMapIndexByName(const char* name) const {
+    return cache.animatedMapNameIndex.find(dna.definition.animatedMapNames, name);
+}
+
 template<class TReaderBase>
 inline std::uint16_t ReaderImpl<TReaderBase>::getAnimatedMapIndexListCount() const {
     return dna.definition.lodAnimatedMapMapping.getIndexListCount();
@@ -369,12 +413,16 @@ inline std::uint16_t ReaderImpl<TReaderBase>::getMeshCount() const {
 template<class TReaderBase>
 inline StringView ReaderImpl<TReaderBase>::getMeshName(std::uint16_t index) const {
     if (index < dna.definition.meshNames.size()) {
-        const auto& meshName = dna.definition.meshNames[index];
-        return {meshName.data(), meshName.size()};
+        return dna.definition.meshNames[index];
     }
     return {};
 }
 
+template<class TReaderBase>
+inline std::uint16_t ReaderImpl<TReaderBase>::getMeshIndexByName(const char* name) const {
+    return cache.meshNameIndex.find(dna.definition.meshNames, name);
+}
+
 template<class TReaderBase>
 inline std::uint16_t ReaderImpl<TReaderBase>::getMeshIndexListCount() const {
     return dna.definition.lodMeshMapping.getIndexListCount();
@@ -783,8 +831,7 @@ inline ConstArrayView<std::uint32_t> ReaderImpl<TReaderBase>::getFaceVertexLayou
                                                                                          std::uint32_t faceIndex) const {
     const auto& meshes = dna.geometry.meshes;
     if ((meshIndex < meshes.size()) && (faceIndex < meshes[meshIndex].faces.size())) {
-        const auto& layoutIndices = meshes[meshIndex].faces[faceIndex].layoutIndices;
-        return {layoutIndices.data(), layoutIndices.size()};
+        return meshes[meshIndex].faces.layoutIndices.get(faceIndex);
     }
     return {};
 }
@@ -858,8 +905,7 @@ inline ConstArrayView<float> ReaderImpl<TReaderBase>::getSkinWeightsValues(std::
                                                                            std::uint32_t vertexIndex) const {
     const auto& meshes = dna.geometry.meshes;
     if ((meshIndex < meshes.size()) && (vertexIndex < meshes[meshIndex].skinWeights.size())) {
-        const auto& weights = meshes[meshIndex].skinWeights[vertexIndex].weights;
-        return {weights.data(), weights.size()};
+        return meshes[meshIndex].skinWeights.weights.get(vertexIndex);
     }
     return {};
 }
@@ -869,8 +915,7 @@ inline ConstArrayView<std::uint16_t> ReaderImpl<TReaderBase>::getSkinWeightsJoin
                                                                                          std::uint32_t vertexIndex) const {
     const auto& meshes = dna.geometry.meshes;
     if ((meshIndex < meshes.size()) && (vertexIndex < meshes[meshIndex].skinWeights.size())) {
-        const auto& jointIndices = meshes[meshIndex].skinWeights[vertexIndex].jointIndices;
-        return {jointIndices.data(), jointIndices.size()};
+        return meshes[meshIndex].skinWeights.jointIndices.get(vertexIndex);
     }
     return {};
 }
@@ -961,6 +1006,68 @@ const {
     return {};
 }
 
+template<class TReaderBase>
+inline MemoryReport ReaderImpl<TReaderBase>::getMemoryReport() const {
+    MemoryReport report{};
+
+    const auto& descriptor = dna.descriptor;
+    report.descriptor = dataSizeOf(descriptor.name) + dataSizeOf(descriptor.complexity) + dataSizeOf(descriptor.dbName);
+    for (const auto& entry : descriptor.metadata) {
+        report.descriptor += dataSizeOf(std::get<0>(entry)) + dataSizeOf(std::get<1>(entry));
+    }
+
+    const auto& definition = dna.definition;
+    report.definition = definition.lodJointMapping.dataSize() +
+        definition.lodBlendShapeMapping.dataSize() +
+        definition.lodAnimatedMapMapping.dataSize() +
+        definition.lodMeshMapping.dataSize() +
+        definition.meshBlendShapeChannelMapping.dataSize() +
+        dataSizeOf(definition.jointHierarchy) +
+        definition.neutralJointTranslations.dataSize() +
+        definition.neutralJointRotations.dataSize();
+    report.names = definition.guiControlNames.dataSize() +
+        definition.rawControlNames.dataSize() +
+        definition.jointNames.dataSize() +
+        definition.blendShapeChannelNames.dataSize() +
+        definition.animatedMapNames.dataSize() +
+        definition.meshNames.dataSize();
+
+    const auto& behavior = dna.behavior;
+    report.conditionals = behavior.controls.conditionals.dataSize();
+    report.psds = behavior.controls.psds.dataSize();
+    for (const auto& jointGroup : behavior.joints.jointGroups) {
+        report.jointGroups += jointGroup.dataSize();
+    }
+    report.blendShapeChannels = dataSizeOf(behavior.blendShapeChannels.lods) +
+        dataSizeOf(behavior.blendShapeChannels.inputIndices) +
+        dataSizeOf(behavior.blendShapeChannels.outputIndices);
+    report.animatedMaps = dataSizeOf(behavior.animatedMaps.lods) + behavior.animatedMaps.conditionals.dataSize();
+
+    for (std::size_t meshIndex = 0ul; meshIndex < dna.geometry.meshes.size(); ++meshIndex) {
+        report.geometry += ReaderImpl::getMeshMemoryReport(static_cast<std::uint16_t>(meshIndex)).total();
+    }
+
+    return report;
+}
+
+template<class TReaderBase>
+inline MeshMemoryReport ReaderImpl<TReaderBase>::getMeshMemoryReport(std::uint16_t meshIndex) const {
+    MeshMemoryReport report{};
+    if (meshIndex < dna.geometry.meshes.size()) {
+        const auto& mesh = dna.geometry.meshes[meshIndex];
+        report.positions = mesh.positions.dataSize();
+        report.textureCoordinates = mesh.textureCoordinates.dataSize();
+        report.normals = mesh.normals.dataSize();
+        report.layouts = mesh.layouts.dataSize();
+        report.faces = mesh.faces.dataSize();
+        report.skinWeights = mesh.skinWeights.dataSize();
+        for (const auto& blendShapeTarget : mesh.blendShapeTargets) {
+            report.blendShapeTargets += blendShapeTarget.dataSize();
+        }
+    }
+    return report;
+}
+
 #ifdef _MSC_VER
     #pragma warning(pop)
 #endif
@@ -9,6 +9,7 @@
 #include <pma/resources/AlignedMemoryResource.h>
 #include <pma/resources/ArenaMemoryResource.h>
 #include <pma/resources/DefaultMemoryResource.h>
+#include <pma/resources/TrackingMemoryResource.h>
 #include <terse/types/DynArray.h>
 
 namespace dna {
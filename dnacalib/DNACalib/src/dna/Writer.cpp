@@ -3,7 +3,9 @@
 #include "dna/Writer.h"
 
 #include "dna/Reader.h"
+#include "dna/ArrayCopyingWriter.h"
 #include "dna/DataLayerBitmask.h"
+#include "dna/ImplementationRegistry.h"
 #include "dna/TypeDefs.h"
 #include "dna/types/Vector3.h"
 
@@ -313,13 +315,6 @@ static bool hasGeometry(const GeometryReader* source) {
 }
 
 static void copyGeometry(const GeometryReader* source, GeometryWriter* destination, MemoryResource* memRes) {
-    destination->clearMeshes();
-
-    if (!hasGeometry(source)) {
-        // Source DNA was loaded without geometry layer
-        return;
-    }
-
     for (std::uint16_t meshIndexPlusOne = source->getMeshCount(); meshIndexPlusOne > 0u; --meshIndexPlusOne) {
         const auto meshIndex = static_cast<std::uint16_t>(meshIndexPlusOne - 1u);
         auto vertexCount = source->getVertexPositionCount(meshIndex);
@@ -348,8 +343,9 @@ static void copyGeometry(const GeometryReader* source, GeometryWriter* destinati
             }, memRes);
         destination->setVertexLayouts(meshIndex, layouts.data(), static_cast<std::uint32_t>(layouts.size()));
 
-        for (std::uint32_t faceIndexPlusOne = source->getFaceCount(meshIndex); faceIndexPlusOne > 0u; --faceIndexPlusOne) {
-            const auto faceIndex = faceIndexPlusOne - 1u;
+        // Faces are stored one after another, so they are set in order, each appended after the previous one
+        const auto faceCount = source->getFaceCount(meshIndex);
+        for (std::uint32_t faceIndex = 0u; faceIndex < faceCount; ++faceIndex) {
             auto faceVertices = source->getFaceVertexLayoutIndices(meshIndex, faceIndex);
             destination->setFaceVertexLayoutIndices(meshIndex, faceIndex, faceVertices.data(),
                                                     static_cast<std::uint32_t>(faceVertices.size()));
@@ -357,9 +353,9 @@ static void copyGeometry(const GeometryReader* source, GeometryWriter* destinati
 
         destination->setMaximumInfluencePerVertex(meshIndex, source->getMaximumInfluencePerVertex(meshIndex));
 
+        // Skin weights are stored the same way, so they are set in vertex order too
         const auto skinWeightsCount = source->getSkinWeightsCount(meshIndex);
-        for (std::uint32_t skinWeightsIndexPlusOne = skinWeightsCount; skinWeightsIndexPlusOne > 0u; --skinWeightsIndexPlusOne) {
-            const auto skinWeightsIndex = skinWeightsIndexPlusOne - 1u;
+        for (std::uint32_t skinWeightsIndex = 0u; skinWeightsIndex < skinWeightsCount; ++skinWeightsIndex) {
             auto skinWeights = source->getSkinWeightsValues(meshIndex, skinWeightsIndex);
             destination->setSkinWeightsValues(meshIndex, skinWeightsIndex, skinWeights.data(),
                                               static_cast<std::uint16_t>(skinWeights.size()));
@@ -382,14 +378,10 @@ static bool hasBlendShapeTargets(const GeometryReader* source) {
 }
 
 static void copyBlendShapeTargets(const GeometryReader* source, GeometryWriter* destination, MemoryResource* memRes) {
-    if (!hasBlendShapeTargets(source)) {
-        // Source DNA was loaded without blend shape targets
-        return;
-    }
-
     for (std::uint16_t meshIndexPlusOne = source->getMeshCount(); meshIndexPlusOne > 0u; --meshIndexPlusOne) {
         const auto meshIndex = static_cast<std::uint16_t>(meshIndexPlusOne - 1u);
-        for (std::uint16_t blendShapeTargetIndexPlusOne = source->getBlendShapeTargetCount(meshIndex);
+        const std::uint16_t blendShapeTargetCount = source->getBlendShapeTargetCount(meshIndex);
+        for (std::uint16_t blendShapeTargetIndexPlusOne = blendShapeTargetCount;
              blendShapeTargetIndexPlusOne > 0u;
              --blendShapeTargetIndexPlusOne) {
             const auto blendShapeTargetIndex = static_cast<std::uint16_t>(blendShapeTargetIndexPlusOne - 1u);
@@ -415,19 +407,38 @@ void Writer::setFrom(const Reader* source, DataLayer layer, MemoryResource* memR
         return;
     }
 
+    // Built-in Writers copy whole arrays at once wherever possible
+    auto arrayCopying = ImplementationRegistry<Writer, ArrayCopyingWriter>::find(this);
     const auto bitmask = computeDataLayerBitmask(layer);
     copyDescriptor(source, this, memRes);
     if (contains(bitmask, DataLayerBitmask::Definition)) {
-        copyDefinition(source, this, memRes);
+        if (arrayCopying != nullptr) {
+            arrayCopying->copyDefinitionFrom(source, memRes);
+        } else {
+            copyDefinition(source, this, memRes);
+        }
     }
     if (contains(bitmask, DataLayerBitmask::Behavior)) {
         copyBehavior(source, this, memRes);
     }
     if (contains(bitmask, DataLayerBitmask::GeometryRest)) {
-        copyGeometry(source, this, memRes);
+        clearMeshes();
+        // Source DNA might have been loaded without geometry layer
+        if (hasGeometry(source)) {
+            if (arrayCopying != nullptr) {
+                arrayCopying->copyGeometryFrom(source, memRes);
+            } else {
+                copyGeometry(source, this, memRes);
+            }
+        }
     }
-    if (contains(bitmask, DataLayerBitmask::GeometryBlendShapesOnly)) {
-        copyBlendShapeTargets(source, this, memRes);
+    // Source DNA might have been loaded without blend shape targets
+    if (contains(bitmask, DataLayerBitmask::GeometryBlendShapesOnly) && hasBlendShapeTargets(source)) {
+        if (arrayCopying != nullptr) {
+            arrayCopying->copyBlendShapeTargetsFrom(source, memRes);
+        } else {
+            copyBlendShapeTargets(source, this, memRes);
+        }
     }
 }
 
@@ -2,7 +2,10 @@
 
 #pragma once
 
+#include "dna/ArrayCopyingWriter.h"
 #include "dna/BaseImpl.h"
+#include "dna/ImplementationRegistry.h"
+#include "dna/Reader.h"
 #include "dna/TypeDefs.h"
 #include "dna/utils/Extd.h"
 
@@ -10,6 +13,7 @@
     #pragma warning(push)
     #pragma warning(disable : 4365 4987)
 #endif
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstring>
@@ -31,8 +35,41 @@ void ensureHasSize(TContainer& target,
     }
 }
 
+template<typename TGetter>
+void copyNames(RawStringTable& destination, std::uint16_t count, TGetter getName) {
+    destination.clear();
+    for (std::uint16_t i = 0u; i < count; ++i) {
+        const auto name = getName(i);
+        destination.push_back(name.data(), name.size());
+    }
+}
+
+// Index lists shared by multiple LODs are stored only once, the same way as when set through the writer
+template<typename TGetter>
+void copyLODMapping(RawLODMapping& destination, std::uint16_t lodCount, TGetter getIndices, MemoryResource* memRes) {
+    destination.reset();
+    Vector<ConstArrayView<std::uint16_t> > indexLists{memRes};
+    for (std::uint16_t lod = 0u; lod < lodCount; ++lod) {
+        const auto indices = getIndices(lod);
+        const auto it = std::find(indexLists.begin(), indexLists.end(), indices);
+        const auto index = static_cast<std::uint16_t>(std::distance(indexLists.begin(), it));
+        if (it == indexLists.end()) {
+            destination.addIndices(index, indices.data(), static_cast<std::uint16_t>(indices.size()));
+            indexLists.push_back(indices);
+        }
+        destination.associateLODWithIndices(lod, index);
+    }
+}
+
+// Padded with zeros (or truncated) to the given size, the same way as when collected element by element
+template<class TArray, typename T>
+void assignResized(TArray& destination, ConstArrayView<T> source, std::size_t size) {
+    destination.assign(source.begin(), source.begin() + std::min(source.size(), size));
+    destination.resize(size, T{});
+}
+
 template<class TWriterBase>
-class WriterImpl : public TWriterBase, public virtual BaseImpl {
+class WriterImpl : public TWriterBase, public dna::ArrayCopyingWriter, public virtual BaseImpl {
     public:
         explicit WriterImpl(MemoryResource* memRes_);
 
@@ -156,6 +193,14 @@ class WriterImpl : public TWriterBase, public virtual BaseImpl {
                                               const std::uint32_t* vertexIndices,
                                               std::uint32_t count) override;
 
+        // ArrayCopyingWriter methods
+        void copyDefinitionFrom(const dna::Reader* source, MemoryResource* memRes_) override;
+        void copyGeometryFrom(const dna::Reader* source, MemoryResource* memRes_) override;
+        void copyBlendShapeTargetsFrom(const dna::Reader* source, MemoryResource* memRes_) override;
+
+    private:
+        dna::ImplementationRegistry<dna::Writer, dna::ArrayCopyingWriter>::Registration registration;
+
 };
 
 
@@ -164,7 +209,7 @@ class WriterImpl : public TWriterBase, public virtual BaseImpl {
     #pragma warning(disable : 4589)
 #endif
 template<class TWriterBase>
-WriterImpl<TWriterBase>::WriterImpl(MemoryResource* memRes_) : BaseImpl{memRes_} {
+WriterImpl<TWriterBase>::WriterImpl(MemoryResource* memRes_) : BaseImpl{memRes_}, registration{this, this} {
 }
 
 #ifdef _MSC_VER
@@ -264,8 +309,7 @@ inline void WriterImpl<TWriterBase>::clearGUIControlNames() {
 
 template<class TWriterBase>
 inline void WriterImpl<TWriterBase>::setGUIControlName(std::uint16_t index, const char* name) {
-    ensureHasSize(dna.definition.guiControlNames, index + 1ul, memRes);
-    dna.definition.guiControlNames[index] = name;
+    dna.definition.guiControlNames.set(index, name, std::strlen(name));
 }
 
 template<class TWriterBase>
@@ -275,8 +319,7 @@ inline void WriterImpl<TWriterBase>::clearRawControlNames() {
 
 template<class TWriterBase>
 inline void WriterImpl<TWriterBase>::setRawControlName(std::uint16_t index, const char* name) {
-    ensureHasSize(dna.definition.rawControlNames, index + 1ul, memRes);
-    dna.definition.rawControlNames[index] = name;
+    dna.definition.rawControlNames.set(index, name, std::strlen(name));
 }
 
 template<class TWriterBase>
@@ -286,8 +329,7 @@ inline void WriterImpl<TWriterBase>::clearJointNames() {
 
 template<class TWriterBase>
 inline void WriterImpl<TWriterBase>::setJointName(std::uint16_t index, const char* name) {
-    ensureHasSize(dna.definition.jointNames, index + 1ul, memRes);
-    dna.definition.jointNames[index] = name;
+    dna.definition.jointNames.set(index, name, std::strlen(name));
 }
 
 template<class TWriterBase>
@@ -324,8 +366,7 @@ inline void WriterImpl<TWriterBase>::clearBlendShapeChannelNames() {
 
 template<class TWriterBase>
 inline void WriterImpl<TWriterBase>::setBlendShapeChannelName(std::uint16_t index, const char* name) {
-    ensureHasSize(dna.definition.blendShapeChannelNames, index + 1ul, memRes);
-    dna.definition.blendShapeChannelNames[index] = name;
+    dna.definition.blendShapeChannelNames.set(index, name, std::strlen(name));
 }
 
 template<class TWriterBase>
@@ -358,8 +399,7 @@ inline void WriterImpl<TWriterBase>::clearAnimatedMapNames() {
 
 template<class TWriterBase>
 inline void WriterImpl<TWriterBase>::setAnimatedMapName(std::uint16_t index, const char* name) {
-    ensureHasSize(dna.definition.animatedMapNames, index + 1ul, memRes);
-    dna.definition.animatedMapNames[index] = name;
+    dna.definition.animatedMapNames.set(index, name, std::strlen(name));
 }
 
 template<class TWriterBase>
@@ -392,8 +432,7 @@ inline void WriterImpl<TWriterBase>::clearMeshNames() {
 
 template<class TWriterBase>
 inline void WriterImpl<TWriterBase>::setMeshName(std::uint16_t index, const char* name) {
-    ensureHasSize(dna.definition.meshNames, index + 1ul, memRes);
-    dna.definition.meshNames[index] = name;
+    dna.definition.meshNames.set(index, name, std::strlen(name));
 }
 
 template<class TWriterBase>
@@ -674,9 +713,7 @@ inline void WriterImpl<TWriterBase>::setFaceVertexLayoutIndices(std::uint16_t me
                                                                 const std::uint32_t* layoutIndices,
                                                                 std::uint32_t count) {
     ensureHasSize(dna.geometry.meshes, meshIndex + 1ul, memRes);
-    auto& faces = dna.geometry.meshes[meshIndex].faces;
-    ensureHasSize(faces, faceIndex + 1ul, memRes);
-    faces[faceIndex].layoutIndices.assign(layoutIndices, layoutIndices + count);
+    dna.geometry.meshes[meshIndex].faces.layoutIndices.set(faceIndex, layoutIndices, count);
 }
 
 template<class TWriterBase>
@@ -698,9 +735,7 @@ inline void WriterImpl<TWriterBase>::setSkinWeightsValues(std::uint16_t meshInde
                                                           const float* weights,
                                                           std::uint16_t count) {
     ensureHasSize(dna.geometry.meshes, meshIndex + 1ul, memRes);
-    auto& skinWeights = dna.geometry.meshes[meshIndex].skinWeights;
-    ensureHasSize(skinWeights, vertexIndex + 1ul, memRes);
-    skinWeights[vertexIndex].weights.assign(weights, weights + count);
+    dna.geometry.meshes[meshIndex].skinWeights.setWeights(vertexIndex, weights, count);
 }
 
 template<class TWriterBase>
@@ -709,9 +744,7 @@ inline void WriterImpl<TWriterBase>::setSkinWeightsJointIndices(std::uint16_t me
                                                                 const std::uint16_t* jointIndices,
                                                                 std::uint16_t count) {
     ensureHasSize(dna.geometry.meshes, meshIndex + 1ul, memRes);
-    auto& skinWeights = dna.geometry.meshes[meshIndex].skinWeights;
-    ensureHasSize(skinWeights, vertexIndex + 1ul, memRes);
-    skinWeights[vertexIndex].jointIndices.assign(jointIndices, jointIndices + count);
+    dna.geometry.meshes[meshIndex].skinWeights.setJointIndices(vertexIndex, jointIndices, count);
 }
 
 template<class TWriterBase>
@@ -751,6 +784,141 @@ inline void WriterImpl<TWriterBase>::setBlendShapeTargetVertexIndices(std::uint1
     blendShapeTargets[blendShapeTargetIndex].vertexIndices.assign(vertexIndices, vertexIndices + count);
 }
 
+template<class TWriterBase>
+inline void WriterImpl<TWriterBase>::copyDefinitionFrom(const dna::Reader* source, MemoryResource* memRes_) {
+    auto& definition = dna.definition;
+    copyNames(definition.guiControlNames, source->getGUIControlCount(), [source](std::uint16_t i) {
+            return source->getGUIControlName(i);
+        });
+    copyNames(definition.rawControlNames, source->getRawControlCount(), [source](std::uint16_t i) {
+            return source->getRawControlName(i);
+        });
+    copyNames(definition.jointNames, source->getJointCount(), [source](std::uint16_t i) {
+            return source->getJointName(i);
+        });
+    copyNames(definition.blendShapeChannelNames, source->getBlendShapeChannelCount(), [source](std::uint16_t i) {
+            return source->getBlendShapeChannelName(i);
+        });
+    copyNames(definition.animatedMapNames, source->getAnimatedMapCount(), [source](std::uint16_t i) {
+            return source->getAnimatedMapName(i);
+        });
+    copyNames(definition.meshNames, source->getMeshCount(), [source](std::uint16_t i) {
+            return source->getMeshName(i);
+        });
+
+    const auto lodCount = source->getLODCount();
+    copyLODMapping(definition.lodJointMapping, lodCount, [source](std::uint16_t lod) {
+            return source->getJointIndicesForLOD(lod);
+        }, memRes_);
+    copyLODMapping(definition.lodBlendShapeMapping, lodCount, [source](std::uint16_t lod) {
+            return source->getBlendShapeChannelIndicesForLOD(lod);
+        }, memRes_);
+    copyLODMapping(definition.lodAnimatedMapMapping, lodCount, [source](std::uint16_t lod) {
+            return source->getAnimatedMapIndicesForLOD(lod);
+        }, memRes_);
+    copyLODMapping(definition.lodMeshMapping, lodCount, [source](std::uint16_t lod) {
+            return source->getMeshIndicesForLOD(lod);
+        }, memRes_);
+
+    const auto jointCount = source->getJointCount();
+    definition.jointHierarchy.resize_uninitialized(jointCount);
+    for (std::uint16_t i = 0u; i < jointCount; ++i) {
+        definition.jointHierarchy[i] = source->getJointParentIndex(i);
+    }
+
+    definition.meshBlendShapeChannelMapping.clear();
+    for (std::uint16_t i = 0u; i < source->getMeshBlendShapeChannelMappingCount(); ++i) {
+        const auto mapping = source->getMeshBlendShapeChannelMapping(i);
+        definition.meshBlendShapeChannelMapping.add(mapping.meshIndex, mapping.blendShapeChannelIndex);
+    }
+
+    assignResized(definition.neutralJointTranslations.xs, source->getNeutralJointTranslationXs(), jointCount);
+    assignResized(definition.neutralJointTranslations.ys, source->getNeutralJointTranslationYs(), jointCount);
+    assignResized(definition.neutralJointTranslations.zs, source->getNeutralJointTranslationZs(), jointCount);
+    assignResized(definition.neutralJointRotations.xs, source->getNeutralJointRotationXs(), jointCount);
+    assignResized(definition.neutralJointRotations.ys, source->getNeutralJointRotationYs(), jointCount);
+    assignResized(definition.neutralJointRotations.zs, source->getNeutralJointRotationZs(), jointCount);
+}
+
+template<class TWriterBase>
+inline void WriterImpl<TWriterBase>::copyGeometryFrom(const dna::Reader* source, MemoryResource*  /*unused*/) {
+    const auto meshCount = source->getMeshCount();
+    ensureHasSize(dna.geometry.meshes, meshCount, memRes);
+    for (std::uint16_t meshIndex = 0u; meshIndex < meshCount; ++meshIndex) {
+        auto& mesh = dna.geometry.meshes[meshIndex];
+
+        const auto xs = source->getVertexPositionXs(meshIndex);
+        const auto ys = source->getVertexPositionYs(meshIndex);
+        const auto zs = source->getVertexPositionZs(meshIndex);
+        mesh.positions.xs.assign(xs.begin(), xs.end());
+        mesh.positions.ys.assign(ys.begin(), ys.end());
+        mesh.positions.zs.assign(zs.begin(), zs.end());
+
+        const auto us = source->getVertexTextureCoordinateUs(meshIndex);
+        const auto vs = source->getVertexTextureCoordinateVs(meshIndex);
+        mesh.textureCoordinates.us.assign(us.begin(), us.end());
+        mesh.textureCoordinates.vs.assign(vs.begin(), vs.end());
+
+        const auto normalXs = source->getVertexNormalXs(meshIndex);
+        const auto normalYs = source->getVertexNormalYs(meshIndex);
+        const auto normalZs = source->getVertexNormalZs(meshIndex);
+        mesh.normals.xs.assign(normalXs.begin(), normalXs.end());
+        mesh.normals.ys.assign(normalYs.begin(), normalYs.end());
+        mesh.normals.zs.assign(normalZs.begin(), normalZs.end());
+
+        const auto positionIndices = source->getVertexLayoutPositionIndices(meshIndex);
+        const auto textureCoordinateIndices = source->getVertexLayoutTextureCoordinateIndices(meshIndex);
+        const auto normalIndices = source->getVertexLayoutNormalIndices(meshIndex);
+        mesh.layouts.positions.assign(positionIndices.begin(), positionIndices.end());
+        mesh.layouts.textureCoordinates.assign(textureCoordinateIndices.begin(), textureCoordinateIndices.end());
+        mesh.layouts.normals.assign(normalIndices.begin(), normalIndices.end());
+
+        const auto faceCount = source->getFaceCount(meshIndex);
+        mesh.faces.layoutIndices.offsets.reserve(faceCount + 1ul);
+        for (std::uint32_t faceIndex = 0u; faceIndex < faceCount; ++faceIndex) {
+            const auto layoutIndices = source->getFaceVertexLayoutIndices(meshIndex, faceIndex);
+            mesh.faces.layoutIndices.set(faceIndex, layoutIndices.data(), layoutIndices.size());
+        }
+
+        mesh.maximumInfluencePerVertex = source->getMaximumInfluencePerVertex(meshIndex);
+
+        const auto skinWeightsCount = source->getSkinWeightsCount(meshIndex);
+        mesh.skinWeights.weights.offsets.reserve(skinWeightsCount + 1ul);
+        mesh.skinWeights.jointIndices.offsets.reserve(skinWeightsCount + 1ul);
+        for (std::uint32_t vertexIndex = 0u; vertexIndex < skinWeightsCount; ++vertexIndex) {
+            const auto weights = source->getSkinWeightsValues(meshIndex, vertexIndex);
+            const auto jointIndices = source->getSkinWeightsJointIndices(meshIndex, vertexIndex);
+            mesh.skinWeights.setWeights(vertexIndex, weights.data(), weights.size());
+            mesh.skinWeights.setJointIndices(vertexIndex, jointIndices.data(), jointIndices.size());
+        }
+    }
+}
+
+template<class TWriterBase>
+inline void WriterImpl<TWriterBase>::copyBlendShapeTargetsFrom(const dna::Reader* source, MemoryResource*  /*unused*/) {
+    for (std::uint16_t meshIndex = 0u; meshIndex < source->getMeshCount(); ++meshIndex) {
+        const auto blendShapeTargetCount = source->getBlendShapeTargetCount(meshIndex);
+        if (blendShapeTargetCount == 0u) {
+            continue;
+        }
+        ensureHasSize(dna.geometry.meshes, meshIndex + 1ul, memRes);
+        auto& blendShapeTargets = dna.geometry.meshes[meshIndex].blendShapeTargets;
+        ensureHasSize(blendShapeTargets, blendShapeTargetCount, memRes);
+        for (std::uint16_t blendShapeTargetIndex = 0u; blendShapeTargetIndex < blendShapeTargetCount; ++blendShapeTargetIndex) {
+            auto& blendShapeTarget = blendShapeTargets[blendShapeTargetIndex];
+            blendShapeTarget.blendShapeChannelIndex = source->getBlendShapeChannelIndex(meshIndex, blendShapeTargetIndex);
+            const auto xs = source->getBlendShapeTargetDeltaXs(meshIndex, blendShapeTargetIndex);
+            const auto ys = source->getBlendShapeTargetDeltaYs(meshIndex, blendShapeTargetIndex);
+            const auto zs = source->getBlendShapeTargetDeltaZs(meshIndex, blendShapeTargetIndex);
+            blendShapeTarget.deltas.xs.assign(xs.begin(), xs.end());
+            blendShapeTarget.deltas.ys.assign(ys.begin(), ys.end());
+            blendShapeTarget.deltas.zs.assign(zs.begin(), zs.end());
+            const auto vertexIndices = source->getBlendShapeTargetVertexIndices(meshIndex, blendShapeTargetIndex);
+            blendShapeTarget.vertexIndices.assign(vertexIndices.begin(), vertexIndices.end());
+        }
+    }
+}
+
 #ifdef _MSC_VER
     #pragma warning(pop)
 #endif
@@ -27,8 +27,6 @@ void AnimatedMapFilter::apply(RawDefinition& dest) {
     dest.lodAnimatedMapMapping.mapIndices([this](std::uint16_t value) {
             return remappedIndices.at(value);
         });
-    // Delete elements that are not referenced by the new subset of LODs
-    extd::filter(dest.animatedMapNames, extd::byPosition(passingIndices));
 }
 
 bool AnimatedMapFilter::passes(std::uint16_t index) const {
@@ -27,8 +27,6 @@ void BlendShapeFilter::apply(RawDefinition& dest) {
     dest.lodBlendShapeMapping.mapIndices([this](std::uint16_t value) {
             return remappedIndices.at(value);
         });
-    // Delete elements that are not referenced by the new subset of LODs
-    extd::filter(dest.blendShapeChannelNames, extd::byPosition(passingIndices));
     // Delete entries from other mappings that reference any of the deleted elements
     auto ignoredByLODConstraint = [this](std::uint16_t  /*unused*/, std::uint16_t blendShapeIndex) {
             return !extd::contains(passingIndices, blendShapeIndex);
@@ -34,7 +34,7 @@ void JointFilter::apply(RawDefinition& dest) {
             return remappedIndices.at(value);
         });
     // Delete elements that are not referenced by the new subset of LODs
-    extd::filter(dest.jointNames, extd::byPosition(passingIndices));
+    extd::makeOwned(dest.jointHierarchy);
     extd::filter(dest.jointHierarchy, extd::byPosition(passingIndices));
     // Fix joint hierarchy indices
     for (auto& jntIdx : dest.jointHierarchy) {
@@ -48,6 +48,12 @@ void JointFilter::apply(RawDefinition& dest) {
         }
     }
     // Delete entries from other mappings that reference any of the deleted elements
+    extd::makeOwned(dest.neutralJointTranslations.xs);
+    extd::makeOwned(dest.neutralJointTranslations.ys);
+    extd::makeOwned(dest.neutralJointTranslations.zs);
+    extd::makeOwned(dest.neutralJointRotations.xs);
+    extd::makeOwned(dest.neutralJointRotations.ys);
+    extd::makeOwned(dest.neutralJointRotations.zs);
     extd::filter(dest.neutralJointTranslations.xs, extd::byPosition(passingIndices));
     extd::filter(dest.neutralJointTranslations.ys, extd::byPosition(passingIndices));
     extd::filter(dest.neutralJointTranslations.zs, extd::byPosition(passingIndices));
@@ -60,7 +66,10 @@ void JointFilter::apply(RawBehavior& dest) {
     static constexpr std::uint16_t jointAttributeCount = 9u;
 
     for (auto& jointGroup : dest.joints.jointGroups) {
+        extd::makeOwned(jointGroup.lods);
+        extd::makeOwned(jointGroup.outputIndices);
         if (option == Option::All) {
+            extd::makeOwned(jointGroup.jointIndices);
             // Remove joint index from joint group and remap joint indices
             extd::filter(jointGroup.jointIndices, [this](std::uint16_t jntIdx, std::size_t  /*unused*/) {
                     return passes(jntIdx);
@@ -97,10 +106,13 @@ void JointFilter::apply(RawBehavior& dest) {
         }
 
         // Remove joint deltas associated with the removed output indices
-        extd::filter(jointGroup.values, [&rowsToDelete, jointGroupColumnCount](float  /*unused*/, std::size_t index) {
-                const std::uint16_t rowIndex = static_cast<std::uint16_t>(index / jointGroupColumnCount);
-                return (rowsToDelete.find(rowIndex) == rowsToDelete.end());
-            });
+        if (!rowsToDelete.empty()) {
+            extd::makeOwned(jointGroup.values);
+            extd::filter(jointGroup.values, [&rowsToDelete, jointGroupColumnCount](float  /*unused*/, std::size_t index) {
+                    const std::uint16_t rowIndex = static_cast<std::uint16_t>(index / jointGroupColumnCount);
+                    return (rowsToDelete.find(rowIndex) == rowsToDelete.end());
+                });
+        }
         // Recompute LODs
         for (auto& lod : jointGroup.lods) {
             std::uint16_t decrementBy = 0u;
@@ -114,56 +126,63 @@ void JointFilter::apply(RawBehavior& dest) {
     }
 }
 
-void JointFilter::apply(RawVertexSkinWeights& dest) {
+void JointFilter::apply(RawSkinWeightsVector& dest) {
     if (option != Option::All) {
         return;
     }
 
-    auto itWeightSrc = dest.weights.begin();
-    auto itWeightDst = itWeightSrc;
-    auto itJointSrc = dest.jointIndices.begin();
-    auto itJointDst = itJointSrc;
-    float discardedWeights = 0.0f;
-    while (itJointSrc != dest.jointIndices.end()) {
-        if (passes(*itJointSrc)) {
-            *itJointDst = *itJointSrc;
-            ++itJointSrc;
-            ++itJointDst;
-
-            *itWeightDst = *itWeightSrc;
-            ++itWeightSrc;
-            ++itWeightDst;
-        } else {
-            discardedWeights += *itWeightSrc;
-            ++itJointSrc;
-            ++itWeightSrc;
+    // The skin weights of all vertices are rebuilt at once, as filtering them one by one in place would move
+    // the values of all subsequent vertices each time
+    const auto vertexCount = dest.size();
+    RawJaggedArray<float> weights{dest.weights.getMemoryResource()};
+    RawJaggedArray<std::uint16_t> jointIndices{dest.jointIndices.getMemoryResource()};
+    weights.values.reserve(dest.weights.values.size());
+    weights.offsets.reserve(vertexCount + 1ul);
+    weights.offsets.push_back(0u);
+    jointIndices.values.reserve(dest.jointIndices.values.size());
+    jointIndices.offsets.reserve(vertexCount + 1ul);
+    jointIndices.offsets.push_back(0u);
+
+    for (std::size_t vertexIndex = 0ul; vertexIndex < vertexCount; ++vertexIndex) {
+        const auto srcWeights = dest.weights.get(vertexIndex);
+        const auto srcJointIndices = dest.jointIndices.get(vertexIndex);
+        assert(srcWeights.size() == srcJointIndices.size());
+        const auto start = jointIndices.values.size();
+        float discardedWeights = 0.0f;
+        for (std::size_t i = 0ul; i < srcJointIndices.size(); ++i) {
+            if (passes(srcJointIndices[i])) {
+                jointIndices.values.push_back(srcJointIndices[i]);
+                weights.values.push_back(srcWeights[i]);
+            } else {
+                discardedWeights += srcWeights[i];
+            }
         }
-    }
-    dest.jointIndices.resize(static_cast<std::size_t>(std::distance(dest.jointIndices.begin(), itJointDst)));
-    dest.weights.resize(static_cast<std::size_t>(std::distance(dest.weights.begin(), itWeightDst)));
-    assert(dest.jointIndices.size() == dest.weights.size());
 
-    if (passingIndices.empty()) {
-        return;
-    }
-
-    if (dest.jointIndices.empty()) {
-        // Reassign complete influence to root joint
-        dest.jointIndices.resize_uninitialized(1ul);
-        dest.jointIndices[0ul] = rootJointIndex;
-        dest.weights.resize_uninitialized(1ul);
-        dest.weights[0ul] = 1.0f;
-    } else {
-        // Normalize weights
-        for (auto& jntIdx : dest.jointIndices) {
-            jntIdx = remapped(jntIdx);
+        if (!passingIndices.empty()) {
+            if (jointIndices.values.size() == start) {
+                // Reassign complete influence to root joint
+                jointIndices.values.push_back(rootJointIndex);
+                weights.values.push_back(1.0f);
+            } else {
+                // Normalize weights
+                const float normalizationRatio = 1.0f / (1.0f - discardedWeights);
+                for (std::size_t i = start; i < jointIndices.values.size(); ++i) {
+                    jointIndices.values[i] = remapped(jointIndices.values[i]);
+                    weights.values[i] *= normalizationRatio;
+                }
+            }
         }
 
-        const float normalizationRatio = 1.0f / (1.0f - discardedWeights);
-        for (auto& weight : dest.weights) {
-            weight *= normalizationRatio;
-        }
+        jointIndices.offsets.push_back(static_cast<std::uint32_t>(jointIndices.values.size()));
+        weights.offsets.push_back(static_cast<std::uint32_t>(weights.values.size()));
+    }
+
+    if (vertexCount == 0ul) {
+        weights.clear();
+        jointIndices.clear();
     }
+    dest.weights = std::move(weights);
+    dest.jointIndices = std::move(jointIndices);
 }
 
 bool JointFilter::passes(std::uint16_t index) const {
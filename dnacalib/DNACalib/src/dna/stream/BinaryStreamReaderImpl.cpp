@@ -2,8 +2,11 @@
 
 #include "dna/stream/BinaryStreamReaderImpl.h"
 
+#include "dna/DataLayerBitmask.h"
 #include "dna/TypeDefs.h"
+#include "dna/stream/StreamCursor.h"
 #include "dna/types/Limits.h"
+#include "dna/utils/ThreadGroup.h"
 
 #include <status/Provider.h>
 #include <trio/utils/StreamScope.h>
@@ -12,8 +15,13 @@
     #pragma warning(push)
     #pragma warning(disable : 4365 4987)
 #endif
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstring>
 #include <limits>
+#include <mutex>
 #include <tuple>
 #ifdef _MSC_VER
     #pragma warning(pop)
@@ -21,6 +29,30 @@
 
 namespace dna {
 
+namespace {
+
+// Size of the buffer through which each thread reads the meshes it loads
+constexpr std::size_t meshLoaderBufferSize = 64ul * 1024ul;
+
+// Each thread that loads meshes reads them from the stream through its own cursor and archive
+struct MeshLoader {
+    StreamCursor stream;
+    FilteredInputArchive archive;
+    // The status is thread-local, so any errors encountered are copied out of it, to be reported by the calling thread
+    int errorCode;
+    std::array<char, 512ul> errorMessage;
+
+    MeshLoader(const FilteredInputArchive& source, BoundedIOStream* stream_, std::mutex* streamLock, MemoryResource* memRes) :
+        stream{stream_, streamLock, meshLoaderBufferSize, memRes},
+        archive{source, &stream, nullptr},
+        errorCode{},
+        errorMessage{} {
+    }
+
+};
+
+}  // namespace
+
 #ifdef __clang__
     #pragma clang diagnostic push
     #pragma clang diagnostic ignored "-Wglobal-constructors"
@@ -37,7 +69,7 @@ BinaryStreamReader* BinaryStreamReader::create(BoundedIOStream* stream,
                                                std::uint16_t maxLOD,
                                                MemoryResource* memRes) {
     PolyAllocator<BinaryStreamReaderImpl> alloc{memRes};
-    return alloc.newObject(stream, layer, maxLOD, LODLimits::min(), memRes);
+    return alloc.newObject(stream, nullptr, layer, maxLOD, LODLimits::min(), 1u, memRes);
 }
 
 BinaryStreamReader* BinaryStreamReader::create(BoundedIOStream* stream,
@@ -46,7 +78,17 @@ BinaryStreamReader* BinaryStreamReader::create(BoundedIOStream* stream,
                                                std::uint16_t minLOD,
                                                MemoryResource* memRes) {
     PolyAllocator<BinaryStreamReaderImpl> alloc{memRes};
-    return alloc.newObject(stream, layer, maxLOD, minLOD, memRes);
+    return alloc.newObject(stream, nullptr, layer, maxLOD, minLOD, 1u, memRes);
+}
+
+BinaryStreamReader* BinaryStreamReader::create(BoundedIOStream* stream,
+                                               DataLayer layer,
+                                               std::uint16_t maxLOD,
+                                               std::uint16_t minLOD,
+                                               std::uint16_t threadCount,
+                                               MemoryResource* memRes) {
+    PolyAllocator<BinaryStreamReaderImpl> alloc{memRes};
+    return alloc.newObject(stream, nullptr, layer, maxLOD, minLOD, threadCount, memRes);
 }
 
 BinaryStreamReader* BinaryStreamReader::create(BoundedIOStream* stream,
@@ -55,7 +97,28 @@ BinaryStreamReader* BinaryStreamReader::create(BoundedIOStream* stream,
                                                std::uint16_t lodCount,
                                                MemoryResource* memRes) {
     PolyAllocator<BinaryStreamReaderImpl> alloc{memRes};
-    return alloc.newObject(stream, layer, ConstArrayView<std::uint16_t>{lods, lodCount}, memRes);
+    return alloc.newObject(stream, nullptr, layer, ConstArrayView<std::uint16_t>{lods, lodCount}, 1u, memRes);
+}
+
+BinaryStreamReader* BinaryStreamReader::create(BoundedIOStream* stream,
+                                               DataLayer layer,
+                                               std::uint16_t* lods,
+                                               std::uint16_t lodCount,
+                                               std::uint16_t threadCount,
+                                               MemoryResource* memRes) {
+    PolyAllocator<BinaryStreamReaderImpl> alloc{memRes};
+    return alloc.newObject(stream, nullptr, layer, ConstArrayView<std::uint16_t>{lods, lodCount}, threadCount, memRes);
+}
+
+BinaryStreamReader* BinaryStreamReader::create(MemoryMappedFileStream* stream,
+                                               ReadMode mode,
+                                               DataLayer layer,
+                                               std::uint16_t maxLOD,
+                                               std::uint16_t minLOD,
+                                               MemoryResource* memRes) {
+    trio::Mappable* mapping = (mode == ReadMode::Borrow ? stream : nullptr);
+    PolyAllocator<BinaryStreamReaderImpl> alloc{memRes};
+    return alloc.newObject(stream, mapping, layer, maxLOD, minLOD, 1u, memRes);
 }
 
 void BinaryStreamReader::destroy(BinaryStreamReader* instance) {
@@ -66,32 +129,66 @@ void BinaryStreamReader::destroy(BinaryStreamReader* instance) {
 }
 
 BinaryStreamReaderImpl::BinaryStreamReaderImpl(BoundedIOStream* stream_,
+                                               trio::Mappable* mapping_,
                                                DataLayer layer_,
                                                std::uint16_t maxLOD_,
                                                std::uint16_t minLOD_,
+                                               std::uint16_t threadCount_,
                                                MemoryResource* memRes_) :
     BaseImpl{memRes_},
     ReaderImpl{memRes_},
     stream{stream_},
-    archive{stream_, layer_, maxLOD_, minLOD_, memRes_},
+    mapping{mapping_},
+    archive{stream_, mapping_, layer_, maxLOD_, minLOD_, memRes_},
+    threadCount{1u},
+    meshArenaUpstream{memRes_},
+    meshArenas{memRes_},
     lodConstrained{(maxLOD_ != LODLimits::max()) || (minLOD_ != LODLimits::min())} {
+    // Multiple threads are of use only if meshes are to be loaded at all
+    if (contains(computeDataLayerBitmask(layer_), DataLayerBitmask::GeometryRest)) {
+        threadCount = threadCount_;
+    }
+    archive.setMeshLoadingDeferred(threadCount > 1u);
 }
 
 BinaryStreamReaderImpl::BinaryStreamReaderImpl(BoundedIOStream* stream_,
+                                               trio::Mappable* mapping_,
                                                DataLayer layer_,
                                                ConstArrayView<std::uint16_t> lods_,
+                                               std::uint16_t threadCount_,
                                                MemoryResource* memRes_) :
     BaseImpl{memRes_},
     ReaderImpl{memRes_},
     stream{stream_},
-    archive{stream_, layer_, lods_, memRes_},
+    mapping{mapping_},
+    archive{stream_, mapping_, layer_, lods_, memRes_},
+    threadCount{1u},
+    meshArenaUpstream{memRes_},
+    meshArenas{memRes_},
     lodConstrained{true} {
+    if (contains(computeDataLayerBitmask(layer_), DataLayerBitmask::GeometryRest)) {
+        threadCount = threadCount_;
+    }
+    archive.setMeshLoadingDeferred(threadCount > 1u);
+}
+
+BinaryStreamReaderImpl::~BinaryStreamReaderImpl() {
+    // Meshes loaded concurrently refer to the arenas, which are destroyed before the meshes themselves would be
+    releaseMeshes();
 }
 
 bool BinaryStreamReaderImpl::isLODConstrained() const {
     return lodConstrained;
 }
 
+DNA& BinaryStreamReaderImpl::getLoadedDNA() {
+    return dna;
+}
+
+bool BinaryStreamReaderImpl::isDataBorrowed() const {
+    return (mapping != nullptr);
+}
+
 void BinaryStreamReaderImpl::unload(DataLayer layer) {
     if ((layer == DataLayer::All) ||
         (layer == DataLayer::AllWithoutBlendShapes) ||
@@ -106,6 +203,9 @@ void BinaryStreamReaderImpl::unload(DataLayer layer) {
         dna.unloadBehavior();
         dna.unloadDefinition();
     }
+    if (dna.geometry.meshes.empty()) {
+        meshArenas.clear();
+    }
 }
 
 void BinaryStreamReaderImpl::read() {
@@ -113,11 +213,37 @@ void BinaryStreamReaderImpl::read() {
     // as external streams do not have access to the status reset API
     status.reset();
 
+    if (mapping != nullptr) {
+        // Data borrowed during a previous read refers to the stream's current mapping, which is about to be
+        // released by reopening the stream
+        dna = DNA{memRes};
+        stream->close();
+        stream->open();
+        if (!sc::Status::isOk()) {
+            return;
+        }
+        load();
+        // The stream is kept open only if the borrowed data will actually be used
+        if (!sc::Status::isOk()) {
+            stream->close();
+        }
+        return;
+    }
+
     trio::StreamScope scope{stream};
     if (!sc::Status::isOk()) {
         return;
     }
 
+    load();
+}
+
+void BinaryStreamReaderImpl::load() {
+    if (threadCount > 1u) {
+        // Meshes are not touched by the archive when their loading is deferred, so those of a previous read must be
+        // released explicitly
+        releaseMeshes();
+    }
     archive >> dna;
     if (!sc::Status::isOk()) {
         return;
@@ -135,6 +261,88 @@ void BinaryStreamReaderImpl::read() {
                    dna.version.version.got);
         return;
     }
+
+    if (threadCount > 1u) {
+        loadMeshes();
+    }
+}
+
+void BinaryStreamReaderImpl::loadMeshes() {
+    const auto meshPositions = archive.getSkippedMeshPositions();
+    const auto meshEndPositions = archive.getSkippedMeshEndPositions();
+    if (meshPositions.size() == 0ul) {
+        return;
+    }
+
+    const std::size_t meshCount = meshPositions.size();
+    // Stored and loaded mesh data are of similar size, so the arena of each mesh should rarely need to grow
+    meshArenas.reserve(meshCount);
+    dna.geometry.meshes.reserve(meshCount);
+    for (std::size_t i = 0ul; i < meshCount; ++i) {
+        #if !defined(__clang__) && defined(__GNUC__)
+            #pragma GCC diagnostic push
+            #pragma GCC diagnostic ignored "-Wuseless-cast"
+        #endif
+        const auto meshSize = static_cast<std::size_t>(meshEndPositions[i] - meshPositions[i]);
+        #if !defined(__clang__) && defined(__GNUC__)
+            #pragma GCC diagnostic pop
+        #endif
+        const auto initialSize = meshSize + meshSize / 8ul + 1024ul;
+        meshArenas.emplace_back(initialSize, initialSize / 4ul, 2.0f, &meshArenaUpstream);
+        dna.geometry.meshes.emplace_back(&meshArenas.back());
+    }
+
+    const std::size_t loaderCount = std::min(static_cast<std::size_t>(threadCount), meshCount);
+    PolyAllocator<MeshLoader> alloc{memRes};
+    Vector<MeshLoader*> loaders{memRes};
+    loaders.reserve(loaderCount);
+    // Only the meshes that are to be loaded are read, each by the thread that loads it, through its own position in the
+    // stream, so streams that can't be read positionally are repositioned on every access, which is serialized
+    std::mutex streamLock;
+    for (std::size_t i = 0ul; i < loaderCount; ++i) {
+        loaders.push_back(alloc.newObject(archive, stream, &streamLock, memRes));
+    }
+
+    std::atomic<std::size_t> nextMeshIndex{0ul};
+    std::atomic<bool> failed{false};
+    auto loadMeshesWith = [this, &meshPositions, &nextMeshIndex, &failed, meshCount](MeshLoader* loader) {
+            // Tags are per thread, so each thread tags the meshes it loads on its own
+            ScopedAllocationTag tag{"geometry"};
+            for (auto meshIndex = nextMeshIndex++; (meshIndex < meshCount) && !failed; meshIndex = nextMeshIndex++) {
+                ScopedAllocationTag meshTag{"mesh", meshIndex};
+                loader->archive.loadCompleteMesh(dna.geometry.meshes[meshIndex], meshPositions[meshIndex]);
+                if (!sc::Status::isOk()) {
+                    const auto error = sc::Status::get();
+                    loader->errorCode = error.code;
+                    std::strncpy(loader->errorMessage.data(), error.message, loader->errorMessage.size() - 1ul);
+                    failed = true;
+                }
+            }
+        };
+
+    // The calling thread loads meshes as well, alongside the additionally started threads
+    {
+        ThreadGroup threads{memRes};
+        threads.reserve(loaderCount - 1ul);
+        for (std::size_t i = 1ul; i < loaderCount; ++i) {
+            threads.start(loadMeshesWith, loaders[i]);
+        }
+        loadMeshesWith(loaders[0]);
+    }
+
+    for (auto loader : loaders) {
+        if ((loader->errorCode != 0) && sc::Status::isOk()) {
+            status.set(sc::StatusCode{loader->errorCode, loader->errorMessage.data()});
+        }
+        alloc.deleteObject(loader);
+    }
+}
+
+void BinaryStreamReaderImpl::releaseMeshes() {
+    if (!meshArenas.empty()) {
+        dna.unloadGeometry();
+        meshArenas.clear();
+    }
 }
 
 }  // namespace dna
@@ -6,32 +6,61 @@
 #include "dna/ReaderImpl.h"
 #include "dna/TypeDefs.h"
 #include "dna/stream/FilteredInputArchive.h"
+#include "dna/utils/SynchronizedMemoryResource.h"
 
 #include <status/Provider.h>
 
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <cstdint>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
 namespace dna {
 
 class BinaryStreamReaderImpl : public ReaderImpl<BinaryStreamReader> {
     public:
         BinaryStreamReaderImpl(BoundedIOStream* stream_,
+                               trio::Mappable* mapping_,
                                DataLayer layer_,
                                std::uint16_t maxLOD_,
                                std::uint16_t minLOD_,
+                               std::uint16_t threadCount_,
                                MemoryResource* memRes_);
         BinaryStreamReaderImpl(BoundedIOStream* stream_,
+                               trio::Mappable* mapping_,
                                DataLayer layer_,
                                ConstArrayView<std::uint16_t> lods,
+                               std::uint16_t threadCount_,
                                MemoryResource* memRes_);
+        ~BinaryStreamReaderImpl() override;
 
         void unload(DataLayer layer) override;
         void read() override;
         bool isLODConstrained() const;
+        // The loaded data, for its containers to be taken over by a reader that is about to replace this one
+        DNA& getLoadedDNA();
+        // Whether loaded data may refer to the mapped stream, instead of being owned by the reader
+        bool isDataBorrowed() const;
+
+    private:
+        void load();
+        void loadMeshes();
+        void releaseMeshes();
 
     private:
         static sc::StatusProvider status;
 
         BoundedIOStream* stream;
+        trio::Mappable* mapping;
         FilteredInputArchive archive;
+        std::uint16_t threadCount;
+        // Meshes loaded concurrently are allocated from arenas (one for each mesh), backed by the reader's memory resource
+        SynchronizedMemoryResource meshArenaUpstream;
+        Vector<ArenaMemoryResource> meshArenas;
         bool lodConstrained;
 };
 
@@ -4,19 +4,209 @@
 
 #include "dna/TypeDefs.h"
 
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
 #include <cstddef>
 #include <cstring>
+#include <mutex>
+#include <thread>
 #include <tuple>
 #include <utility>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
 
 namespace dna {
 
+// Each section and mesh written by multiple threads is written into its own stream, through its own archive
+struct BinaryStreamWriterImpl::ChunkWriter {
+    ScopedPtr<MemoryStream> stream;
+    LayoutAwareOutputArchive archive;
+
+    ChunkWriter(const DNA& source, MemoryResource* memRes) :
+        stream{makeScoped<MemoryStream>(memRes)},
+        archive{stream.get(), source, memRes} {
+    }
+
+};
+
+// Chunks are written by worker threads while the thread writing the whole DNA appends them to its stream, in order.
+// Workers hold off with writing chunks that are too far ahead of the last appended one, so only a bounded number of
+// chunks is kept in memory at any time, and each chunk is freed as soon as it's appended
+class BinaryStreamWriterImpl::ChunkPipeline : public LayoutAwareOutputArchive::ChunkSource {
+    private:
+        enum class State {
+            Pending,
+            Written,
+            Failed
+        };
+
+    public:
+        // The descriptor, definition and behavior are followed by the meshes, in the order in which they are written
+        static constexpr std::size_t sectionCount = 3ul;
+
+    public:
+        ChunkPipeline(DNA& dna_, std::size_t chunkCount, std::size_t windowSize_, MemoryResource* memRes_) :
+            dna{dna_},
+            memRes{memRes_},
+            chunkWriters{chunkCount, nullptr, memRes_},
+            states{chunkCount, State::Pending, memRes_},
+            windowSize{windowSize_},
+            nextChunk{0ul},
+            acquired{0ul},
+            released{0ul},
+            failed{false},
+            stopped{false} {
+        }
+
+        ~ChunkPipeline() {
+            for (std::size_t i = 0ul; i < chunkWriters.size(); ++i) {
+                destroy(i);
+            }
+        }
+
+        ChunkPipeline(const ChunkPipeline&) = delete;
+        ChunkPipeline& operator=(const ChunkPipeline&) = delete;
+
+        ChunkPipeline(ChunkPipeline&&) = delete;
+        ChunkPipeline& operator=(ChunkPipeline&&) = delete;
+
+        // Executed by each worker thread
+        void run() {
+            const std::size_t chunkCount = states.size();
+            for (auto chunkIndex = nextChunk++; chunkIndex < chunkCount; chunkIndex = nextChunk++) {
+                bool skip = false;
+                {
+                    std::unique_lock<std::mutex> lock{mutex};
+                    condition.wait(lock, [this, chunkIndex]() {
+                            return stopped || (chunkIndex < released + windowSize);
+                        });
+                    // Once any chunk fails, the rest of the data is written directly as well
+                    skip = failed || stopped;
+                }
+                ChunkWriter* chunkWriter = nullptr;
+                State state = State::Failed;
+                if (!skip) {
+                    PolyAllocator<ChunkWriter> alloc{memRes};
+                    chunkWriter = alloc.newObject(dna, memRes);
+                    write(chunkWriter->archive, chunkIndex);
+                    // The status is thread-local, so errors are only flagged here
+                    state = (sc::Status::isOk() ? State::Written : State::Failed);
+                }
+                {
+                    std::unique_lock<std::mutex> lock{mutex};
+                    chunkWriters[chunkIndex] = chunkWriter;
+                    states[chunkIndex] = state;
+                    failed = failed || (state == State::Failed);
+                }
+                condition.notify_all();
+            }
+        }
+
+        // Lets workers waiting for earlier chunks to be appended finish without writing any more chunks
+        void stop() {
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                stopped = true;
+            }
+            condition.notify_all();
+        }
+
+        LayoutAwareOutputArchive* acquire() override {
+            std::unique_lock<std::mutex> lock{mutex};
+            const auto chunkIndex = acquired++;
+            assert(chunkIndex == released);
+            if (chunkIndex >= states.size()) {
+                return nullptr;
+            }
+            condition.wait(lock, [this, chunkIndex]() {
+                    return states[chunkIndex] != State::Pending;
+                });
+            if (states[chunkIndex] == State::Written) {
+                return &chunkWriters[chunkIndex]->archive;
+            }
+            // Data of chunks that failed to be written is written directly instead, where the error is going to be
+            // reported from
+            advance(lock);
+            return nullptr;
+        }
+
+        void release() override {
+            std::unique_lock<std::mutex> lock{mutex};
+            advance(lock);
+        }
+
+    private:
+        void advance(std::unique_lock<std::mutex>& lock) {
+            destroy(released);
+            ++released;
+            lock.unlock();
+            condition.notify_all();
+        }
+
+        void destroy(std::size_t chunkIndex) {
+            if (chunkWriters[chunkIndex] != nullptr) {
+                PolyAllocator<ChunkWriter> alloc{memRes};
+                alloc.deleteObject(chunkWriters[chunkIndex]);
+                chunkWriters[chunkIndex] = nullptr;
+            }
+        }
+
+        void write(LayoutAwareOutputArchive& chunk, std::size_t chunkIndex) {
+            if (chunkIndex == 0ul) {
+                chunk.writeChunk(dna.descriptor);
+            } else if (chunkIndex == 1ul) {
+                chunk.writeChunk(dna.definition);
+            } else if (chunkIndex == 2ul) {
+                chunk.writeChunk(dna.behavior);
+            } else {
+                chunk.writeChunk(dna.geometry.meshes[chunkIndex - sectionCount]);
+            }
+        }
+
+    private:
+        DNA& dna;
+        MemoryResource* memRes;
+        Vector<ChunkWriter*> chunkWriters;
+        Vector<State> states;
+        // The number of chunks that may be written ahead of the last appended chunk
+        std::size_t windowSize;
+        std::atomic<std::size_t> nextChunk;
+        std::size_t acquired;
+        std::size_t released;
+        bool failed;
+        bool stopped;
+        std::mutex mutex;
+        std::condition_variable condition;
+
+};
+
+constexpr std::size_t BinaryStreamWriterImpl::ChunkPipeline::sectionCount;
+
 BinaryStreamWriter::~BinaryStreamWriter() = default;
 
 BinaryStreamWriter* BinaryStreamWriter::create(BoundedIOStream* stream, MemoryResource* memRes) {
     PolyAllocator<BinaryStreamWriterImpl> alloc{memRes};
-    return alloc.newObject(stream, memRes);
+    return alloc.newObject(stream, ByteOrder::Network, 1u, memRes);
+}
+
+BinaryStreamWriter* BinaryStreamWriter::create(BoundedIOStream* stream, ByteOrder byteOrder, MemoryResource* memRes) {
+    PolyAllocator<BinaryStreamWriterImpl> alloc{memRes};
+    return alloc.newObject(stream, byteOrder, 1u, memRes);
+}
+
+BinaryStreamWriter* BinaryStreamWriter::create(BoundedIOStream* stream,
+                                               ByteOrder byteOrder,
+                                               std::uint16_t threadCount,
+                                               MemoryResource* memRes) {
+    PolyAllocator<BinaryStreamWriterImpl> alloc{memRes};
+    return alloc.newObject(stream, byteOrder, threadCount, memRes);
 }
 
 void BinaryStreamWriter::destroy(BinaryStreamWriter* instance) {
@@ -26,18 +216,62 @@ void BinaryStreamWriter::destroy(BinaryStreamWriter* instance) {
     alloc.deleteObject(writer);
 }
 
-BinaryStreamWriterImpl::BinaryStreamWriterImpl(BoundedIOStream* stream_, MemoryResource* memRes_) :
+BinaryStreamWriterImpl::BinaryStreamWriterImpl(BoundedIOStream* stream_,
+                                               ByteOrder byteOrder_,
+                                               std::uint16_t threadCount_,
+                                               MemoryResource* memRes_) :
     BaseImpl{memRes_},
     WriterImpl{memRes_},
     stream{stream_},
-    archive{stream_} {
+    byteOrder{byteOrder_},
+    threadCount{threadCount_},
+    chunkMemRes{memRes_},
+    archive{stream_, &chunkMemRes} {
 }
 
 void BinaryStreamWriterImpl::write() {
+    // Files in network byte order are written in the original format version, so earlier versions of the library
+    // remain able to read them
+    if (byteOrder == ByteOrder::Native) {
+        dna.version = Version{2u, RawLayout::version};
+        const bool littleEndian = (terse::nativeEndianness() == terse::Endianness::Little);
+        dna.layout.byteOrder = (littleEndian ? RawLayout::littleEndian : RawLayout::bigEndian);
+    } else {
+        dna.version = Version{2u, 1u};
+        dna.layout.byteOrder = RawLayout::bigEndian;
+    }
+
     stream->open();
-    archive << dna;
+    if (threadCount > 1u) {
+        writeChunked();
+    } else {
+        archive << dna;
+    }
     archive.sync();
     stream->close();
 }
 
+void BinaryStreamWriterImpl::writeChunked() {
+    const std::size_t chunkCount = ChunkPipeline::sectionCount + dna.geometry.meshes.size();
+    const std::size_t workerCount = std::min(static_cast<std::size_t>(threadCount), chunkCount);
+    // Each worker may have a chunk being written and another one waiting to be appended
+    ChunkPipeline pipeline{dna, chunkCount, 2ul * workerCount, &chunkMemRes};
+    Vector<std::thread> workers{&chunkMemRes};
+    workers.reserve(workerCount);
+    for (std::size_t i = 0ul; i < workerCount; ++i) {
+        workers.emplace_back([&pipeline]() {
+                pipeline.run();
+            });
+    }
+
+    archive.setChunks(&pipeline);
+    archive << dna;
+    archive.setChunks(nullptr);
+
+    pipeline.stop();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
 }  // namespace dna
@@ -5,20 +5,39 @@
 #include "dna/DNA.h"
 #include "dna/BinaryStreamWriter.h"
 #include "dna/WriterImpl.h"
-
-#include <terse/archives/binary/OutputArchive.h>
+#include "dna/stream/LayoutAwareOutputArchive.h"
+#include "dna/utils/SynchronizedMemoryResource.h"
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <cstdint>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
 
 namespace dna {
 
 class BinaryStreamWriterImpl : public WriterImpl<BinaryStreamWriter> {
+    private:
+        struct ChunkWriter;
+        class ChunkPipeline;
+
     public:
-        BinaryStreamWriterImpl(BoundedIOStream* stream_, MemoryResource* memRes_);
+        BinaryStreamWriterImpl(BoundedIOStream* stream_, ByteOrder byteOrder_, std::uint16_t threadCount_, MemoryResource* memRes_);
 
         void write() override;
 
+    private:
+        void writeChunked();
+
     private:
         BoundedIOStream* stream;
-        terse::BinaryOutputArchive<BoundedIOStream> archive;
+        ByteOrder byteOrder;
+        std::uint16_t threadCount;
+        SynchronizedMemoryResource chunkMemRes;
+        LayoutAwareOutputArchive archive;
 
 };
 
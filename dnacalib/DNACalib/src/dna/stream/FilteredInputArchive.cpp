@@ -3,10 +3,13 @@
 #include "dna/stream/FilteredInputArchive.h"
 
 #include "dna/DNA.h"
+#include "dna/StreamReader.h"
 #include "dna/TypeDefs.h"
 #include "dna/utils/Extd.h"
 #include "dna/utils/ScopedEnumEx.h"
 
+#include <status/Provider.h>
+
 #ifdef _MSC_VER
     #pragma warning(push)
     #pragma warning(disable : 4365 4987)
@@ -35,7 +38,30 @@ static UnorderedMap<U, U> remappedPositions(const Vector<T>& target, const Unord
     return mapping;
 }
 
+namespace {
+
+// Container adapter through which an array stored in the stream is loaded at the end of an existing container
+template<class TContainer>
+struct Appender {
+    using value_type = typename TContainer::value_type;
+
+    TContainer* container;
+    std::size_t start;
+
+    void resize(std::size_t size) {
+        container->resize(start + size);
+    }
+
+    value_type& operator[](std::size_t index) {
+        return (*container)[start + index];
+    }
+
+};
+
+}  // namespace
+
 FilteredInputArchive::FilteredInputArchive(BoundedIOStream* stream_,
+                                           trio::Mappable* mapping_,
                                            DataLayer layer_,
                                            std::uint16_t maxLOD_,
                                            std::uint16_t minLOD_,
@@ -46,13 +72,19 @@ FilteredInputArchive::FilteredInputArchive(BoundedIOStream* stream_,
     MeshFilter{memRes_},
     BaseArchive{this, stream_},
     stream{stream_},
+    mapping{mapping_},
     memRes{memRes_},
     layerBitmask{computeDataLayerBitmask(layer_)},
     lodConstraint{maxLOD_, minLOD_, memRes},
-    unconstrainedLODCount{} {
+    unconstrainedLODCount{},
+    skippedMeshPositions{memRes},
+    skippedMeshEndPositions{memRes},
+    meshLoadingDeferred{false},
+    formatVersion{} {
 }
 
 FilteredInputArchive::FilteredInputArchive(BoundedIOStream* stream_,
+                                           trio::Mappable* mapping_,
                                            DataLayer layer_,
                                            ConstArrayView<std::uint16_t> lods_,
                                            MemoryResource* memRes_) :
@@ -62,10 +94,86 @@ FilteredInputArchive::FilteredInputArchive(BoundedIOStream* stream_,
     MeshFilter{memRes_},
     BaseArchive{this, stream_},
     stream{stream_},
+    mapping{mapping_},
     memRes{memRes_},
     layerBitmask{computeDataLayerBitmask(layer_)},
     lodConstraint{lods_, memRes},
-    unconstrainedLODCount{} {
+    unconstrainedLODCount{},
+    skippedMeshPositions{memRes},
+    skippedMeshEndPositions{memRes},
+    meshLoadingDeferred{false},
+    formatVersion{} {
+}
+
+FilteredInputArchive::FilteredInputArchive(const FilteredInputArchive& source,
+                                           BoundedIOStream* stream_,
+                                           MemoryResource* memRes_) :
+    AnimatedMapFilter{source},
+    BlendShapeFilter{source},
+    JointFilter{source},
+    MeshFilter{source},
+    BaseArchive{this, stream_},
+    stream{stream_},
+    mapping{nullptr},
+    memRes{memRes_},
+    layerBitmask{source.layerBitmask},
+    lodConstraint{source.lodConstraint},
+    unconstrainedLODCount{source.unconstrainedLODCount},
+    skippedMeshPositions{memRes_},
+    skippedMeshEndPositions{memRes_},
+    meshLoadingDeferred{false},
+    formatVersion{source.formatVersion} {
+    setByteOrder(source.byteOrder());
+    setElementAlignment(source.elementAlignment());
+    setStorageAlignment(source.storageAlignment());
+}
+
+void FilteredInputArchive::setMeshLoadingDeferred(bool deferred) {
+    meshLoadingDeferred = deferred;
+}
+
+ConstArrayView<std::uint64_t> FilteredInputArchive::getSkippedMeshPositions() const {
+    return {skippedMeshPositions.data(), skippedMeshPositions.size()};
+}
+
+ConstArrayView<std::uint64_t> FilteredInputArchive::getSkippedMeshEndPositions() const {
+    return {skippedMeshEndPositions.data(), skippedMeshEndPositions.size()};
+}
+
+void FilteredInputArchive::loadBehavior(RawBehavior& dest) {
+    ScopedAllocationTag tag{"behavior"};
+    // The markers seek to the beginning of each section on their own
+    process(dest.marker);
+    process(dest.controlsMarker);
+    process(dest.controls);
+    process(dest.jointsMarker);
+    process(dest.joints);
+    process(dest.blendShapeChannelsMarker);
+    process(dest.blendShapeChannels);
+    process(dest.animatedMapsMarker);
+    process(dest.animatedMaps);
+}
+
+std::uint64_t FilteredInputArchive::loadMesh(RawMesh& dest, std::uint64_t position) {
+    stream->seek(position);
+    process(dest.offset);
+    processGeometryRest(dest);
+    return stream->tell();
+}
+
+void FilteredInputArchive::loadBlendShapeTargets(RawMesh& dest, std::uint64_t position) {
+    stream->seek(position);
+    processBlendShapeTargets(dest);
+}
+
+void FilteredInputArchive::loadBlendShapeTarget(RawBlendShapeTarget& dest, std::uint64_t position) {
+    stream->seek(position);
+    process(dest);
+}
+
+void FilteredInputArchive::loadCompleteMesh(RawMesh& dest, std::uint64_t position) {
+    stream->seek(position);
+    process(dest);
 }
 
 template<class TContainer>
@@ -73,16 +181,82 @@ void FilteredInputArchive::processSubset(TContainer& dest, std::size_t offset, s
     using ElementType = typename TContainer::value_type;
     const auto availableSize = processSize();
     assert(offset + size <= availableSize);
+    if (availableSize != 0ul) {
+        processPadding<TContainer>();
+    }
     const auto startPosition = stream->tell();
     // Skip over first N elements
     stream->seek(startPosition + offset * sizeof(ElementType));
     // Read requested number of elements
-    BaseArchive::processElements(dest, size);
+    if (!borrow(dest, size)) {
+        BaseArchive::processElements(dest, size);
+    }
     // Even if not all elements were read, seek to the end of the list
     stream->seek(startPosition + availableSize * sizeof(ElementType));
 }
 
+template<typename TPredicate>
+void FilteredInputArchive::processFiltered(RawStringTable& dest, TPredicate predicate) {
+    if (formatVersion >= RawLayout::version) {
+        // The characters of all strings are stored together, so the whole table is loaded before filtering it
+        process(dest);
+        dest.filter([&predicate](StringView  /*unused*/, std::size_t index) {
+                return predicate(static_cast<std::uint16_t>(index));
+            });
+        return;
+    }
+    const auto size = processSize();
+    dest.clear();
+    for (std::size_t i = 0ul; i < size; ++i) {
+        if (predicate(static_cast<std::uint16_t>(i))) {
+            processAppend(dest);
+        } else {
+            skip<String<char> >();
+        }
+    }
+}
+
+std::size_t FilteredInputArchive::peekSize() {
+    const auto position = stream->tell();
+    const auto size = processSize();
+    stream->seek(position);
+    return size;
+}
+
+template<class TContainer>
+void FilteredInputArchive::skip() {
+    using ElementType = typename TContainer::value_type;
+    static_assert(terse::traits::is_batchable<TContainer>::value, "Only containers of trivial elements can be skipped.");
+    const auto size = processSize();
+    if (size != 0ul) {
+        processPadding<TContainer>();
+        stream->seek(stream->tell() + size * sizeof(ElementType));
+    }
+}
+
+void FilteredInputArchive::process(DNA& dest) {
+    // Everything up to the layout is stored in network byte order
+    setByteOrder(terse::Endianness::Network);
+    setElementAlignment(false);
+    setStorageAlignment(false);
+    BaseArchive::process(dest);
+}
+
+void FilteredInputArchive::process(Version& dest) {
+    BaseArchive::process(dest);
+    formatVersion = dest.version.got;
+}
+
+void FilteredInputArchive::process(RawLayout& dest) {
+    process(dest.byteOrder);
+    setByteOrder(dest.byteOrder == RawLayout::littleEndian ? terse::Endianness::Little : terse::Endianness::Big);
+    setElementAlignment(true);
+    setStorageAlignment(true);
+    process(dest.index);
+}
+
 void FilteredInputArchive::process(RawDescriptor& dest) {
+    ScopedAllocationTag tag{"descriptor"};
     BaseArchive::process(dest);
     assert(dest.lodCount > 0u);
     lodConstraint.clampTo(dest.lodCount);
@@ -95,18 +269,29 @@ void FilteredInputArchive::process(RawDefinition& dest) {
     if (!contains(layerBitmask, DataLayerBitmask::Definition)) {
         return;
     }
-    // Load all data
-    BaseArchive::process(dest);
+    ScopedAllocationTag tag{"definition"};
     // No filtering is done, unless LOD constraint may have some effect
     if (!lodConstraint.hasImpactOn(unconstrainedLODCount)) {
+        BaseArchive::process(dest);
         return;
     }
 
+    // The LOD mappings precede all the data they refer to, so the filters can be configured upfront, and the names
+    // that would be filtered out are not loaded at all
+    process(dest.marker);
+    process(dest.lodJointMapping);
+    process(dest.lodBlendShapeMapping);
+    process(dest.lodAnimatedMapMapping);
+    process(dest.lodMeshMapping);
+    process(dest.guiControlNames);
+    process(dest.rawControlNames);
+
     // To find joints that are not in any LOD, find the joints that are not in LOD 0 (the current max LOD, at index 0), as it
     // contains joints from all lower LODs.
+    const auto jointCount = peekSize();
     Vector<std::uint16_t> jointsNotInLOD0{memRes};
     const auto jointIndicesForLOD0 = dest.lodJointMapping.getIndices(0);
-    for (std::uint16_t idx = 0; idx < dest.jointNames.size(); ++idx) {
+    for (std::uint16_t idx = 0; idx < jointCount; ++idx) {
         if (std::find(jointIndicesForLOD0.begin(), jointIndicesForLOD0.end(), idx) == jointIndicesForLOD0.end()) {
             jointsNotInLOD0.push_back(idx);
         }
@@ -117,33 +302,44 @@ void FilteredInputArchive::process(RawDefinition& dest) {
     dest.lodJointMapping.discardLODs(lodConstraint);
     dest.lodBlendShapeMapping.discardLODs(lodConstraint);
     dest.lodAnimatedMapMapping.discardLODs(lodConstraint);
-    MeshFilter::configure(static_cast<std::uint16_t>(dest.meshNames.size()),
-                          dest.lodMeshMapping.getCombinedDistinctIndices(memRes));
-    MeshFilter::apply(dest);
+
     auto allowedJointIndices = dest.lodJointMapping.getCombinedDistinctIndices(memRes);
     // In order to keep joints that are not in any LOD, add them all to the list of joints to keep when filtering.
     allowedJointIndices.insert(jointsNotInLOD0.begin(), jointsNotInLOD0.end());
-    JointFilter::configure(static_cast<std::uint16_t>(dest.jointNames.size()), allowedJointIndices);
-    JointFilter::apply(dest);
-    BlendShapeFilter::configure(static_cast<std::uint16_t>(dest.blendShapeChannelNames.size()),
+    JointFilter::configure(static_cast<std::uint16_t>(jointCount), allowedJointIndices);
+    processFiltered(dest.jointNames, [this](std::uint16_t index) {
+            return JointFilter::passes(index);
+        });
+    BlendShapeFilter::configure(static_cast<std::uint16_t>(peekSize()),
                                 dest.lodBlendShapeMapping.getCombinedDistinctIndices(memRes));
-    BlendShapeFilter::apply(dest);
-    AnimatedMapFilter::configure(static_cast<std::uint16_t>(dest.animatedMapNames.size()),
+    processFiltered(dest.blendShapeChannelNames, [this](std::uint16_t index) {
+            return BlendShapeFilter::passes(index);
+        });
+    AnimatedMapFilter::configure(static_cast<std::uint16_t>(peekSize()),
                                  dest.lodAnimatedMapMapping.getCombinedDistinctIndices(memRes));
+    processFiltered(dest.animatedMapNames, [this](std::uint16_t index) {
+            return AnimatedMapFilter::passes(index);
+        });
+    MeshFilter::configure(static_cast<std::uint16_t>(peekSize()),
+                          dest.lodMeshMapping.getCombinedDistinctIndices(memRes));
+    processFiltered(dest.meshNames, [this](std::uint16_t index) {
+            return MeshFilter::passes(index);
+        });
+
+    process(dest.meshBlendShapeChannelMapping);
+    process(dest.jointHierarchy);
+    process(dest.neutralJointTranslations);
+    process(dest.neutralJointRotations);
+
+    MeshFilter::apply(dest);
+    JointFilter::apply(dest);
+    BlendShapeFilter::apply(dest);
     AnimatedMapFilter::apply(dest);
 }
 
 void FilteredInputArchive::process(RawBehavior& dest) {
     if (contains(layerBitmask, DataLayerBitmask::Behavior)) {
-        process(dest.marker);
-        process(dest.controlsMarker);
-        process(dest.controls);
-        process(dest.jointsMarker);
-        process(dest.joints);
-        process(dest.blendShapeChannelsMarker);
-        process(dest.blendShapeChannels);
-        process(dest.animatedMapsMarker);
-        process(dest.animatedMaps);
+        loadBehavior(dest);
     }
 }
 
@@ -173,6 +369,7 @@ void FilteredInputArchive::process(RawJoints& dest) {
 
         processSubset(jointGroup.outputIndices, 0ul, jointGroupRowCount);
         // Remap joint attribute indices
+        extd::makeOwned(jointGroup.outputIndices);
         for (auto& attrIdx : jointGroup.outputIndices) {
             const auto jntIdx = static_cast<std::uint16_t>(attrIdx / jointAttributeCount);
             const auto relAttrIdx = attrIdx - (jntIdx * jointAttributeCount);
@@ -182,6 +379,7 @@ void FilteredInputArchive::process(RawJoints& dest) {
         processSubset(jointGroup.values, 0ul, jointGroupRowCount * jointGroupColumnCount);
         // Load and remap joint indices (according to the remapping created while loading the Definition layer)
         process(jointGroup.jointIndices);
+        extd::makeOwned(jointGroup.jointIndices);
         extd::filter(jointGroup.jointIndices, [this](std::uint16_t jntIdx, std::size_t  /*unused*/) {
                 return JointFilter::passes(jntIdx);
             });
@@ -227,34 +425,45 @@ void FilteredInputArchive::process(RawAnimatedMaps& dest) {
 }
 
 void FilteredInputArchive::process(RawGeometry& dest) {
+    ScopedAllocationTag tag{"geometry"};
     process(dest.marker);
 
-    if (!contains(layerBitmask, DataLayerBitmask::GeometryRest)) {
+    if (!contains(layerBitmask, DataLayerBitmask::GeometryRest) || meshLoadingDeferred) {
         // As mesh sizes are variable, iterate over each of them, reading only the mesh
         // offsets and jumping over the actual data of the meshes.
         // This will correctly position the underlying stream (end of geometry layer),
         // while still not reading the data.
         const auto meshCount = processSize();
+        const bool filtered = lodConstraint.hasImpactOn(unconstrainedLODCount);
+        skippedMeshPositions.clear();
+        skippedMeshEndPositions.clear();
         decltype(RawMesh::offset) meshOffset{};
         decltype(RawMesh::marker) meshMarker{meshOffset};
         for (std::uint16_t i = {}; i < meshCount; ++i) {
+            // Remember where each mesh is, so it can still be loaded later on
+            const bool passes = (!filtered || MeshFilter::passes(i));
+            if (passes) {
+                skippedMeshPositions.push_back(stream->tell());
+            }
             process(meshOffset);
+            if (passes) {
+                skippedMeshEndPositions.push_back(meshOffset.value);
+            }
             process(meshMarker);
         }
         return;
     }
 
-    if (!lodConstraint.hasImpactOn(unconstrainedLODCount)) {
-        process(dest.meshes);
-        return;
-    }
     // Perform filtered load only if a different maxLOD is set
+    const bool filtered = lodConstraint.hasImpactOn(unconstrainedLODCount);
     const auto meshCount = processSize();
+    dest.meshes.clear();
     dest.meshes.reserve(meshCount);
     for (std::uint16_t i = {}; i < meshCount; ++i) {
         RawMesh mesh{memRes};
         // Check if the mesh indices filtered for the current maxLOD permit loading this mesh
-        if (MeshFilter::passes(i)) {
+        if (!filtered || MeshFilter::passes(i)) {
+            ScopedAllocationTag meshTag{"mesh", i};
             process(mesh);
             dest.meshes.push_back(std::move(mesh));
         } else {
@@ -267,6 +476,14 @@ void FilteredInputArchive::process(RawGeometry& dest) {
 
 void FilteredInputArchive::process(RawMesh& dest) {
     process(dest.offset);
+    processGeometryRest(dest);
+    if (contains(layerBitmask, DataLayerBitmask::GeometryBlendShapesOnly)) {
+        processBlendShapeTargets(dest);
+    }
+    process(dest.marker);
+}
+
+void FilteredInputArchive::processGeometryRest(RawMesh& dest) {
     process(dest.positions);
     process(dest.textureCoordinates);
     process(dest.normals);
@@ -274,25 +491,156 @@ void FilteredInputArchive::process(RawMesh& dest) {
     process(dest.faces);
     process(dest.maximumInfluencePerVertex);
     process(dest.skinWeights);
-    if (contains(layerBitmask, DataLayerBitmask::GeometryBlendShapesOnly)) {
+}
+
+void FilteredInputArchive::processBlendShapeTargets(RawMesh& dest) {
+    if (!lodConstraint.hasImpactOn(unconstrainedLODCount)) {
         process(dest.blendShapeTargets);
-        if (lodConstraint.hasImpactOn(unconstrainedLODCount)) {
-            extd::filter(dest.blendShapeTargets, [this](const RawBlendShapeTarget& bst, std::size_t  /*unused*/) {
-                    return BlendShapeFilter::passes(bst.blendShapeChannelIndex);
-                });
+        return;
+    }
+    // The blend shape channel index of each target is stored after its data, so it's looked up first, skipping over
+    // the data, which is then loaded only for the targets that pass the LOD constraints
+    const auto blendShapeTargetCount = processSize();
+    const auto startPosition = stream->tell();
+    std::size_t passedCount = 0ul;
+    for (std::size_t i = 0ul; i < blendShapeTargetCount; ++i) {
+        passedCount += static_cast<std::size_t>(skipBlendShapeTarget());
+    }
+    const auto endPosition = stream->tell();
+
+    stream->seek(startPosition);
+    dest.blendShapeTargets.clear();
+    dest.blendShapeTargets.reserve(passedCount);
+    for (std::size_t i = 0ul; i < blendShapeTargetCount; ++i) {
+        const auto position = stream->tell();
+        if (skipBlendShapeTarget()) {
+            stream->seek(position);
+            dest.blendShapeTargets.push_back(terse::impl::ValueFactory<RawBlendShapeTarget>::create(
+                                                     dest.blendShapeTargets.get_allocator()));
+            process(dest.blendShapeTargets.back());
         }
     }
-    process(dest.marker);
+    stream->seek(endPosition);
+}
+
+bool FilteredInputArchive::skipBlendShapeTarget() {
+    // Skipped as the same types they are stored from, so they are padded the same way
+    skip<decltype(RawVector3Vector::xs)>();
+    skip<decltype(RawVector3Vector::ys)>();
+    skip<decltype(RawVector3Vector::zs)>();
+    skip<decltype(RawBlendShapeTarget::vertexIndices)>();
+    std::uint16_t blendShapeChannelIndex = {};
+    process(blendShapeChannelIndex);
+    return BlendShapeFilter::passes(blendShapeChannelIndex);
 }
 
-void FilteredInputArchive::process(RawVertexSkinWeights& dest) {
-    process(dest.weights);
-    process(dest.jointIndices);
+void FilteredInputArchive::process(RawIndex& dest) {
+    BaseArchive::process(dest);
+    if (!lodConstraint.hasImpactOn(unconstrainedLODCount)) {
+        return;
+    }
+    // Keep only the entries of meshes and blend shape targets that pass the LOD constraints, so they match the
+    // (filtered) indices of the loaded data
+    extd::filter(dest.meshes, [this](const RawMeshIndex&  /*unused*/, std::size_t meshIndex) {
+            return MeshFilter::passes(static_cast<std::uint16_t>(meshIndex));
+        });
+    for (auto& meshIndex : dest.meshes) {
+        extd::makeOwned(meshIndex.blendShapeTargetPositions);
+        extd::makeOwned(meshIndex.blendShapeChannelIndices);
+        std::size_t retained = 0ul;
+        for (std::size_t i = 0ul; i < meshIndex.blendShapeChannelIndices.size(); ++i) {
+            if (BlendShapeFilter::passes(meshIndex.blendShapeChannelIndices[i])) {
+                meshIndex.blendShapeTargetPositions[retained] = meshIndex.blendShapeTargetPositions[i];
+                meshIndex.blendShapeChannelIndices[retained] = meshIndex.blendShapeChannelIndices[i];
+                ++retained;
+            }
+        }
+        meshIndex.blendShapeTargetPositions.resize(retained);
+        meshIndex.blendShapeChannelIndices.resize(retained);
+    }
+}
+
+template<typename T>
+void FilteredInputArchive::processAppend(RawJaggedArray<T>& dest) {
+    if (dest.offsets.empty()) {
+        dest.offsets.push_back(0u);
+    }
+    Appender<Vector<T> > values{&dest.values, dest.values.size()};
+    BaseArchive::processElements(values, processSize());
+    dest.offsets.push_back(static_cast<std::uint32_t>(dest.values.size()));
+}
+
+void FilteredInputArchive::processAppend(RawStringTable& dest) {
+    if (dest.offsets.empty()) {
+        dest.offsets.push_back(0u);
+    }
+    Appender<Vector<char> > characters{&dest.characters, dest.characters.size()};
+    BaseArchive::processElements(characters, processSize());
+    dest.characters.push_back('\0');
+    dest.offsets.push_back(static_cast<std::uint32_t>(dest.characters.size()));
+}
+
+void FilteredInputArchive::process(RawFaceVector& dest) {
+    // Faces are stored one by one, so the layout indices of each face are loaded right after those of the previous one
+    const auto faceCount = processSize();
+    dest.clear();
+    dest.layoutIndices.offsets.reserve(faceCount + 1ul);
+    for (std::size_t i = 0ul; i < faceCount; ++i) {
+        processAppend(dest.layoutIndices);
+    }
+}
+
+void FilteredInputArchive::process(RawSkinWeightsVector& dest) {
+    // Skin weights are stored vertex by vertex, with the weights of each vertex followed by its joint indices
+    const auto vertexCount = processSize();
+    dest.clear();
+    dest.weights.offsets.reserve(vertexCount + 1ul);
+    dest.jointIndices.offsets.reserve(vertexCount + 1ul);
+    for (std::size_t i = 0ul; i < vertexCount; ++i) {
+        processAppend(dest.weights);
+        processAppend(dest.jointIndices);
+    }
 
     if (lodConstraint.hasImpactOn(unconstrainedLODCount)) {
-        assert(dest.weights.size() == dest.jointIndices.size());
         JointFilter::apply(dest);
     }
 }
 
+void FilteredInputArchive::process(RawStringTable& dest) {
+    const auto stringCount = processSize();
+    dest.clear();
+    if (formatVersion < RawLayout::version) {
+        // Strings are stored one by one, so the characters of each string are loaded right after those of the previous one
+        dest.offsets.reserve(stringCount + 1ul);
+        for (std::size_t i = 0ul; i < stringCount; ++i) {
+            processAppend(dest);
+        }
+        return;
+    }
+
+    // Stored as represented in memory, except for the total number of characters, which is the size of the characters
+    BaseArchive::processElements(dest.offsets, stringCount);
+    process(dest.characters);
+    if (stringCount == 0ul) {
+        return;
+    }
+    dest.offsets.push_back(static_cast<std::uint32_t>(dest.characters.size()));
+    bool valid = (dest.offsets[0ul] == 0u);
+    for (std::size_t i = 0ul; valid && (i < stringCount); ++i) {
+        valid = (dest.offsets[i] < dest.offsets[i + 1ul]) && (dest.characters[dest.offsets[i + 1ul] - 1ul] == '\0');
+    }
+    if (!valid) {
+        // Malformed tables are discarded, so the strings they contain are never viewed past the end of the characters
+        dest.clear();
+        // Unless it's malformed only because reading the stream already failed
+        if (sc::StatusProvider::isOk()) {
+            sc::StatusProvider::set(StreamReader::InvalidDataError);
+        }
+    }
+}
+
+void FilteredInputArchive::process(terse::Transparent<RawStringTable>&& dest) {
+    process(dest.data);
+}
+
 }  // namespace dna
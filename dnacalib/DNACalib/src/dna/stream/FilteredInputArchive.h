@@ -12,21 +12,39 @@
 #include "dna/filters/MeshFilter.h"
 
 #include <terse/archives/binary/InputArchive.h>
+#include <terse/types/Transparent.h>
+#include <trio/Concepts.h>
 
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
 #include <cstddef>
 #include <cstdint>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
 
 namespace dna {
 
+struct DNA;
 struct RawAnimatedMaps;
 struct RawBehavior;
 struct RawBlendShapeChannels;
+struct RawBlendShapeTarget;
 struct RawDefinition;
 struct RawDescriptor;
+struct RawFaceVector;
+template<typename T>
+struct RawJaggedArray;
 struct RawGeometry;
+struct RawIndex;
 struct RawJoints;
+struct RawLayout;
 struct RawMesh;
-struct RawVertexSkinWeights;
+struct RawSkinWeightsVector;
+struct RawStringTable;
+struct Version;
 
 class FilteredInputArchive final : public AnimatedMapFilter, public BlendShapeFilter, public JointFilter, public MeshFilter,
     public terse::ExtendableBinaryInputArchive<FilteredInputArchive,
@@ -44,16 +62,40 @@ class FilteredInputArchive final : public AnimatedMapFilter, public BlendShapeFi
 
     public:
         FilteredInputArchive(BoundedIOStream* stream_,
+                             trio::Mappable* mapping_,
                              DataLayer layer_,
                              std::uint16_t maxLOD_,
                              std::uint16_t minLOD_,
                              MemoryResource* memRes_);
         FilteredInputArchive(BoundedIOStream* stream_,
+                             trio::Mappable* mapping_,
                              DataLayer layer_,
                              ConstArrayView<std::uint16_t> lods_,
                              MemoryResource* memRes_);
+        // Shares the data layer, LOD constraint and filter configuration of the given archive, but reads from
+        // the given stream, so that multiple archives may load meshes concurrently
+        FilteredInputArchive(const FilteredInputArchive& source, BoundedIOStream* stream_, MemoryResource* memRes_);
+
+        // When deferred, meshes are skipped over (as if the geometry layer was not requested) while processing the
+        // geometry layer, so they can be loaded separately afterwards
+        void setMeshLoadingDeferred(bool deferred);
+        // Stream positions of the meshes that were not loaded while processing the geometry layer, one for each mesh
+        // that passes the LOD constraints
+        ConstArrayView<std::uint64_t> getSkippedMeshPositions() const;
+        ConstArrayView<std::uint64_t> getSkippedMeshEndPositions() const;
+        // Used to load the data that was skipped earlier on demand, after the DNA has already been processed
+        void loadBehavior(RawBehavior& dest);
+        // Loads everything but the blend shape targets, and returns the stream position at which the targets start
+        std::uint64_t loadMesh(RawMesh& dest, std::uint64_t position);
+        void loadBlendShapeTargets(RawMesh& dest, std::uint64_t position);
+        void loadBlendShapeTarget(RawBlendShapeTarget& dest, std::uint64_t position);
+        // Loads the whole mesh, including blend shape targets (if the requested data layer contains them)
+        void loadCompleteMesh(RawMesh& dest, std::uint64_t position);
 
     private:
+        void process(DNA& dest);
+        void process(Version& dest);
+        void process(RawLayout& dest);
         void process(RawDescriptor& dest);
         void process(RawDefinition& dest);
         void process(RawBehavior& dest);
@@ -61,23 +103,89 @@ class FilteredInputArchive final : public AnimatedMapFilter, public BlendShapeFi
         void process(RawBlendShapeChannels& dest);
         void process(RawAnimatedMaps& dest);
         void process(RawGeometry& dest);
+        void process(RawIndex& dest);
         void process(RawMesh& dest);
-        void process(RawVertexSkinWeights& dest);
+        void process(RawFaceVector& dest);
+        void process(RawSkinWeightsVector& dest);
+        void process(RawStringTable& dest);
+        void process(terse::Transparent<RawStringTable>&& dest);
+
+        template<typename T, class TAllocator>
+        void process(terse::DynArray<T, TAllocator>& dest) {
+            const auto size = processSize();
+            if (!borrow(dest, size)) {
+                BaseArchive::processElements(dest, size);
+            }
+        }
 
         template<typename ... Args>
         void process(Args&& ... args) {
             BaseArchive::process(std::forward<Args>(args)...);
         }
 
+        // Loads an array stored in the stream as the next array of the given jagged array
+        template<typename T>
+        void processAppend(RawJaggedArray<T>& dest);
+        // Loads a string stored in the stream as the next string of the given string table
+        void processAppend(RawStringTable& dest);
+
+        void processGeometryRest(RawMesh& dest);
+        void processBlendShapeTargets(RawMesh& dest);
+
         template<typename TContainer>
         void processSubset(TContainer& dest, std::size_t offset, std::size_t size);
 
+        template<typename TPredicate>
+        void processFiltered(RawStringTable& dest, TPredicate predicate);
+
+        template<typename TContainer>
+        void skip();
+
+        std::size_t peekSize();
+        bool skipBlendShapeTarget();
+
+        template<typename TContainer>
+        bool borrow(TContainer&  /*unused*/, std::size_t  /*unused*/) {
+            return false;
+        }
+
+        template<typename T, class TAllocator>
+        bool borrow(terse::DynArray<T, TAllocator>& dest, std::size_t size) {
+            using ContainerType = terse::DynArray<T, TAllocator>;
+            // Only data stored in native byte order can be referenced directly from the mapped stream,
+            // everything else still needs to be copied and swapped
+            const bool swapNeeded = (sizeof(T) > 1ul) && (byteOrder() != terse::nativeEndianness());
+            if ((mapping == nullptr) || (size == 0ul) || swapNeeded || !terse::traits::is_batchable<ContainerType>::value) {
+                return false;
+            }
+            processPadding<ContainerType>();
+            const auto position = stream->tell();
+            const std::size_t byteCount = size * sizeof(T);
+            const char* source = mapping->view(position, byteCount);
+            // Borrowed storage must be aligned just as the storage the array would allocate itself (e.g. aligned
+            // arrays guarantee a larger alignment than that of their elements), otherwise the elements are copied
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            if ((source == nullptr) || ((reinterpret_cast<std::uintptr_t>(source) % ContainerType::alignment()) != 0ul)) {
+                return false;
+            }
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            dest.borrow(reinterpret_cast<const T*>(source), size);
+            stream->seek(position + byteCount);
+            return true;
+        }
+
     private:
         BoundedIOStream* stream;
+        trio::Mappable* mapping;
         MemoryResource* memRes;
         DataLayerBitmask layerBitmask;
         LODConstraint lodConstraint;
         std::uint16_t unconstrainedLODCount;
+        Vector<std::uint64_t> skippedMeshPositions;
+        Vector<std::uint64_t> skippedMeshEndPositions;
+        bool meshLoadingDeferred;
+        // Format version of the DNA being loaded, as some data is stored differently across versions
+        std::uint16_t formatVersion;
 
 };
 
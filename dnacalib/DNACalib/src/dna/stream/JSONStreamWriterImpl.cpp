@@ -34,6 +34,8 @@ JSONStreamWriterImpl::JSONStreamWriterImpl(BoundedIOStream* stream_, std::uint32
 }
 
 void JSONStreamWriterImpl::write() {
+    // Byte order is irrelevant for text, so the original format version is written
+    dna.version = Version{2u, 1u};
     stream->open();
     archive << dna;
     archive.sync();
@@ -0,0 +1,381 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "dna/DNA.h"
+#include "dna/TypeDefs.h"
+
+#include <terse/archives/binary/OutputArchive.h>
+#include <terse/types/Transparent.h>
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace dna {
+
+class LayoutAwareOutputArchive final : public terse::ExtendableBinaryOutputArchive<LayoutAwareOutputArchive,
+                                                                                   BoundedIOStream,
+                                                                                   std::uint32_t,
+                                                                                   std::uint32_t,
+                                                                                   terse::Endianness::Network> {
+    private:
+        using BaseArchive = terse::ExtendableBinaryOutputArchive<LayoutAwareOutputArchive,
+                                                                 BoundedIOStream,
+                                                                 std::uint32_t,
+                                                                 std::uint32_t,
+                                                                 terse::Endianness::Network>;
+        friend Archive<LayoutAwareOutputArchive>;
+
+        using Offset = terse::ArchiveOffset<std::uint32_t>;
+        using Marker = std::pair<Offset*, std::uint32_t>;
+
+        // In the native layout, sections and meshes are aligned to (at least) the largest alignment of any array,
+        // so the padding of the elements they contain does not depend on where they are placed in the stream
+        static constexpr std::size_t sectionAlignment = 64ul;
+
+    public:
+        // Provides the chunks that are appended by the archive writing the whole DNA, in the order in which they are appended
+        class ChunkSource {
+            public:
+                // Returns nullptr if the next chunk is not available, in which case its data is written directly instead
+                virtual LayoutAwareOutputArchive* acquire() = 0;
+                // Invoked once the most recently acquired chunk has been appended, after which it's no longer accessed
+                virtual void release() = 0;
+
+            protected:
+                virtual ~ChunkSource() = default;
+
+        };
+
+    public:
+        // The given memory resource is used only for the bookkeeping of the archive itself
+        LayoutAwareOutputArchive(BoundedIOStream* stream_, MemoryResource* memRes_) :
+            BaseArchive{this, stream_},
+            stream{stream_},
+            memRes{memRes_},
+            meshIndices{memRes_},
+            chunked{false},
+            chunkStart{},
+            chunkOffsets{memRes_},
+            chunkMarkers{memRes_},
+            chunks{nullptr},
+            formatVersion{} {
+        }
+
+        // Creates an archive that writes a single section or mesh of the given DNA (a chunk) into a stream of its own,
+        // in the layout in which the DNA is going to be written, so chunks can be written concurrently and later appended
+        // to the archive that writes the whole DNA
+        LayoutAwareOutputArchive(BoundedIOStream* stream_, const DNA& source, MemoryResource* memRes_) :
+            BaseArchive{this, stream_},
+            stream{stream_},
+            memRes{memRes_},
+            meshIndices{memRes_},
+            chunked{true},
+            chunkStart{},
+            chunkOffsets{memRes_},
+            chunkMarkers{memRes_},
+            chunks{nullptr},
+            formatVersion{source.version.version.expected} {
+            if (formatVersion >= RawLayout::version) {
+                setLayout(source.layout);
+            }
+        }
+
+        template<class TChunk>
+        void writeChunk(TChunk& source) {
+            // The chunk starts at the same position relative to the section alignment as its data will be placed at
+            // in the final stream, so padding within it is the same either way
+            pad(chunkAlignmentOffset(source));
+            chunkStart = tell();
+            process(source);
+        }
+
+        // Chunks of the given source are appended instead of writing the descriptor, definition, behavior and the meshes,
+        // in that order
+        void setChunks(ChunkSource* chunks_) {
+            chunks = chunks_;
+        }
+
+    private:
+        void process(DNA& source) {
+            // Everything up to the layout is written in network byte order
+            setByteOrder(terse::Endianness::Network);
+            setElementAlignment(false);
+            setStorageAlignment(false);
+            formatVersion = source.version.version.expected;
+            meshIndices.clear();
+            BaseArchive::process(source);
+        }
+
+        void process(RawLayout& source) {
+            process(source.byteOrder);
+            setLayout(source);
+            process(source.index);
+        }
+
+        void process(RawDescriptor& source) {
+            processSection(source);
+        }
+
+        void process(RawDefinition& source) {
+            processSection(source);
+        }
+
+        void process(RawBehavior& source) {
+            processSection(source);
+        }
+
+        void process(RawIndex& source) {
+            // Positions of the meshes are collected while the meshes are being written (possibly while other threads are
+            // still writing chunks), and are stored into the index only once all of them have been written
+            auto dnaMemRes = source.meshes.get_allocator().getMemoryResource();
+            source.meshes.clear();
+            source.meshes.reserve(meshIndices.size());
+            for (const auto& meshIndex : meshIndices) {
+                source.meshes.emplace_back(dnaMemRes);
+                auto& dest = source.meshes.back();
+                dest.position = meshIndex.position;
+                dest.skinWeights = meshIndex.skinWeights;
+                dest.blendShapeTargets = meshIndex.blendShapeTargets;
+                dest.blendShapeTargetPositions.assign(meshIndex.blendShapeTargetPositions.begin(),
+                                                      meshIndex.blendShapeTargetPositions.end());
+                dest.blendShapeChannelIndices.assign(meshIndex.blendShapeChannelIndices.begin(),
+                                                     meshIndex.blendShapeChannelIndices.end());
+            }
+            BaseArchive::process(source);
+        }
+
+        void process(RawGeometry& source) {
+            pad(0ul);
+            BaseArchive::process(source);
+        }
+
+        void process(RawMesh& source) {
+            process(static_cast<const RawMesh&>(source));
+        }
+
+        void process(const RawMesh& source) {
+            if (appendNextChunk()) {
+                return;
+            }
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+            auto& mesh = const_cast<RawMesh&>(source);
+            RawMeshIndex meshIndex{memRes};
+            meshIndex.position = tell();
+            process(mesh.offset);
+            process(mesh.positions);
+            process(mesh.textureCoordinates);
+            process(mesh.normals);
+            process(mesh.layouts);
+            process(mesh.faces);
+            process(mesh.maximumInfluencePerVertex);
+            meshIndex.skinWeights = tell();
+            process(mesh.skinWeights);
+            meshIndex.blendShapeTargets = tell();
+            const auto blendShapeTargetCount = mesh.blendShapeTargets.size();
+            meshIndex.blendShapeTargetPositions.resize(blendShapeTargetCount);
+            meshIndex.blendShapeChannelIndices.resize(blendShapeTargetCount);
+            processSize(blendShapeTargetCount);
+            for (std::size_t i = 0ul; i < blendShapeTargetCount; ++i) {
+                meshIndex.blendShapeTargetPositions[i] = tell();
+                meshIndex.blendShapeChannelIndices[i] = mesh.blendShapeTargets[i].blendShapeChannelIndex;
+                process(mesh.blendShapeTargets[i]);
+            }
+            // The extent of each mesh is kept a multiple of the section alignment, so all meshes start at the
+            // same position relative to it
+            pad(meshIndex.position);
+            process(mesh.marker);
+            meshIndices.push_back(std::move(meshIndex));
+        }
+
+        void process(RawFaceVector& source) {
+            // Faces are written one by one, each with its own size
+            processSize(source.size());
+            for (std::size_t i = 0ul; i < source.size(); ++i) {
+                const auto layoutIndices = source.layoutIndices.get(i);
+                processSize(layoutIndices.size());
+                processElements(layoutIndices);
+            }
+        }
+
+        void process(RawSkinWeightsVector& source) {
+            // Skin weights are written vertex by vertex, with the weights of each vertex followed by its joint indices
+            processSize(source.size());
+            for (std::size_t i = 0ul; i < source.size(); ++i) {
+                const auto weights = source.weights.get(i);
+                processSize(weights.size());
+                processElements(weights);
+                const auto jointIndices = source.jointIndices.get(i);
+                processSize(jointIndices.size());
+                processElements(jointIndices);
+            }
+        }
+
+        void process(RawStringTable& source) {
+            processSize(source.size());
+            if (formatVersion < RawLayout::version) {
+                for (std::size_t i = 0ul; i < source.size(); ++i) {
+                    const auto string = source[i];
+                    processSize(string.size());
+                    processElements(string);
+                }
+                return;
+            }
+            // Written as represented in memory, except for the total number of characters, which is the size of the characters
+            processElements(ConstArrayView<std::uint32_t>{source.offsets.data(), source.size()});
+            process(source.characters);
+        }
+
+        void process(terse::Transparent<RawStringTable>&& source) {
+            process(source.data);
+        }
+
+        void process(Offset& source) {
+            if (chunked) {
+                chunkOffsets.push_back(&source);
+            }
+            BaseArchive::process(source);
+        }
+
+        void process(Offset::Proxy& source) {
+            if (chunked && (std::find(chunkOffsets.begin(), chunkOffsets.end(), source.target) == chunkOffsets.end())) {
+                // Offsets declared outside of the chunk are written into a different stream, so they can be resolved
+                // only once the chunk is appended to it
+                chunkMarkers.emplace_back(source.target, tell());
+                return;
+            }
+            BaseArchive::process(source);
+        }
+
+        template<typename ... Args>
+        void process(Args&& ... args) {
+            BaseArchive::process(std::forward<Args>(args)...);
+        }
+
+        template<class TSection>
+        void processSection(TSection& source) {
+            pad(0ul);
+            if (!appendNextChunk()) {
+                BaseArchive::process(source);
+            }
+        }
+
+        bool appendNextChunk() {
+            if (chunks == nullptr) {
+                return false;
+            }
+            auto chunk = chunks->acquire();
+            if (chunk == nullptr) {
+                return false;
+            }
+            append(*chunk);
+            chunks->release();
+            return true;
+        }
+
+        void append(LayoutAwareOutputArchive& chunk) {
+            const auto position = tell();
+            const auto chunkEnd = chunk.tell();
+            chunk.stream->seek(chunk.chunkStart);
+            chunk.stream->read(stream, chunkEnd - chunk.chunkStart);
+            const auto end = tell();
+
+            // Everything written into the chunk is moved by the same distance as the chunk itself
+            const auto relocate = [position, &chunk](std::size_t chunkPosition) {
+                    return static_cast<std::uint32_t>(position + (chunkPosition - chunk.chunkStart));
+                };
+            for (auto offset : chunk.chunkOffsets) {
+                offset->position = relocate(offset->position);
+                offset->value = relocate(offset->value);
+                rewrite(*offset);
+            }
+            for (const auto& marker : chunk.chunkMarkers) {
+                marker.first->value = relocate(marker.second);
+                rewrite(*marker.first);
+            }
+            for (const auto& chunkMeshIndex : chunk.meshIndices) {
+                const auto blendShapeTargetCount = chunkMeshIndex.blendShapeTargetPositions.size();
+                RawMeshIndex meshIndex{memRes};
+                meshIndex.position = relocate(chunkMeshIndex.position);
+                meshIndex.skinWeights = relocate(chunkMeshIndex.skinWeights);
+                meshIndex.blendShapeTargets = relocate(chunkMeshIndex.blendShapeTargets);
+                meshIndex.blendShapeTargetPositions.resize(blendShapeTargetCount);
+                meshIndex.blendShapeChannelIndices.resize(blendShapeTargetCount);
+                for (std::size_t i = 0ul; i < blendShapeTargetCount; ++i) {
+                    meshIndex.blendShapeTargetPositions[i] = relocate(chunkMeshIndex.blendShapeTargetPositions[i]);
+                    meshIndex.blendShapeChannelIndices[i] = chunkMeshIndex.blendShapeChannelIndices[i];
+                }
+                meshIndices.push_back(std::move(meshIndex));
+            }
+            stream->seek(end);
+        }
+
+        void rewrite(const Offset& offset) {
+            const auto current = stream->tell();
+            stream->seek(offset.position);
+            process(offset.value);
+            stream->seek(current);
+        }
+
+        void setLayout(const RawLayout& layout) {
+            setByteOrder(layout.byteOrder == RawLayout::littleEndian ? terse::Endianness::Little : terse::Endianness::Big);
+            setElementAlignment(true);
+            setStorageAlignment(true);
+        }
+
+        // Pads the stream up to the next position that is a multiple of the section alignment, counted from the given offset
+        void pad(std::size_t offset) {
+            if (elementAlignment()) {
+                static constexpr char zeros[sectionAlignment] = {};
+                const auto remainder = (tell() + sectionAlignment - offset % sectionAlignment) % sectionAlignment;
+                if (remainder != 0ul) {
+                    stream->write(static_cast<const char*>(zeros), sectionAlignment - remainder);
+                }
+            }
+        }
+
+        template<class TChunk>
+        static std::size_t chunkAlignmentOffset(const TChunk&  /*unused*/) {
+            return 0ul;
+        }
+
+        static std::size_t chunkAlignmentOffset(const RawMesh&  /*unused*/) {
+            // Meshes follow the mesh count at the beginning of the geometry section
+            return sizeof(SizeType);
+        }
+
+        std::uint32_t tell() const {
+            const auto position = stream->tell();
+            assert(position <= std::numeric_limits<std::uint32_t>::max());
+            return static_cast<std::uint32_t>(position);
+        }
+
+    private:
+        BoundedIOStream* stream;
+        MemoryResource* memRes;
+        // Positions of the meshes written so far
+        Vector<RawMeshIndex> meshIndices;
+        // State of archives writing chunks, see the constructor
+        bool chunked;
+        std::uint32_t chunkStart;
+        Vector<Offset*> chunkOffsets;
+        Vector<Marker> chunkMarkers;
+        // Chunks to be appended by the archive writing the whole DNA
+        ChunkSource* chunks;
+        // Format version of the DNA being written, as some data is stored differently across versions
+        std::uint16_t formatVersion;
+
+};
+
+}  // namespace dna
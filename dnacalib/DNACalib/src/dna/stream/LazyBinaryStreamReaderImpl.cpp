@@ -0,0 +1,556 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "dna/stream/LazyBinaryStreamReaderImpl.h"
+
+#include "dna/TypeDefs.h"
+#include "dna/types/Limits.h"
+
+#include <status/Provider.h>
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace dna {
+
+// Note: LazyBinaryStreamReaderImpl::status hasn't been initialized deliberately, as it uses the same error codes that were
+// already registered in BinaryStreamReader, and since they are all registered in a single, global error code registry,
+// this would trigger an assert there.
+
+LazyBinaryStreamReader::~LazyBinaryStreamReader() = default;
+
+LazyBinaryStreamReader* LazyBinaryStreamReader::create(BoundedIOStream* stream, std::uint16_t maxLOD, MemoryResource* memRes) {
+    PolyAllocator<LazyBinaryStreamReaderImpl> alloc{memRes};
+    return alloc.newObject(stream, maxLOD, LODLimits::min(), memRes);
+}
+
+LazyBinaryStreamReader* LazyBinaryStreamReader::create(BoundedIOStream* stream,
+                                                       std::uint16_t maxLOD,
+                                                       std::uint16_t minLOD,
+                                                       MemoryResource* memRes) {
+    PolyAllocator<LazyBinaryStreamReaderImpl> alloc{memRes};
+    return alloc.newObject(stream, maxLOD, minLOD, memRes);
+}
+
+void LazyBinaryStreamReader::destroy(LazyBinaryStreamReader* instance) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    auto reader = static_cast<LazyBinaryStreamReaderImpl*>(instance);
+    PolyAllocator<LazyBinaryStreamReaderImpl> alloc{reader->getMemoryResource()};
+    alloc.deleteObject(reader);
+}
+
+LazyBinaryStreamReaderImpl::LazyBinaryStreamReaderImpl(BoundedIOStream* stream_,
+                                                       std::uint16_t maxLOD_,
+                                                       std::uint16_t minLOD_,
+                                                       MemoryResource* memRes_) :
+    BaseImpl{memRes_},
+    ReaderImpl{memRes_},
+    stream{stream_},
+    loadable{&dna},
+    // Everything past the Definition layer is skipped initially, and loaded explicitly when needed
+    archive{stream_, nullptr, DataLayer::Definition, maxLOD_, minLOD_, memRes_},
+    deferredMeshes{memRes_},
+    behaviorPending{false},
+    deferred{false} {
+}
+
+void LazyBinaryStreamReaderImpl::unload(DataLayer layer) {
+    if ((layer == DataLayer::All) ||
+        (layer == DataLayer::AllWithoutBlendShapes) ||
+        (layer == DataLayer::Descriptor)) {
+        dna = DNA{memRes};
+        deferredMeshes.clear();
+        behaviorPending = false;
+        deferred = false;
+    } else if ((layer == DataLayer::Geometry) || (layer == DataLayer::GeometryWithoutBlendShapes)) {
+        // Meshes are left in place as empty placeholders, so they can be loaded again when accessed
+        for (std::size_t i = 0ul; i < deferredMeshes.size(); ++i) {
+            dna.geometry.meshes[i] = RawMesh{memRes};
+            deferredMeshes[i].loaded = false;
+            deferredMeshes[i].blendShapeTargetsLoaded = false;
+            deferredMeshes[i].pendingBlendShapeTargets.clear();
+        }
+    } else if (layer == DataLayer::Behavior) {
+        dna.unloadBehavior();
+        behaviorPending = deferred;
+    } else if (layer == DataLayer::Definition) {
+        dna.unloadGeometry();
+        dna.unloadBehavior();
+        dna.unloadDefinition();
+        deferredMeshes.clear();
+        behaviorPending = false;
+        deferred = false;
+    }
+}
+
+void LazyBinaryStreamReaderImpl::read() {
+    // Due to possible usage of custom stream implementations, the status actually must be cleared at this point
+    // as external streams do not have access to the status reset API
+    status.reset();
+
+    dna = DNA{memRes};
+    deferredMeshes.clear();
+    behaviorPending = false;
+    deferred = false;
+
+    // The stream is reopened in case it was left open by a previous read
+    stream->close();
+    stream->open();
+    if (!sc::Status::isOk()) {
+        return;
+    }
+
+    archive >> dna;
+    if (!sc::Status::isOk()) {
+        stream->close();
+        return;
+    }
+
+    if (!dna.signature.matches()) {
+        status.set(SignatureMismatchError, dna.signature.value.expected.data(), dna.signature.value.got.data());
+        stream->close();
+        return;
+    }
+    if (!dna.version.matches()) {
+        status.set(VersionMismatchError,
+                   dna.version.generation.expected,
+                   dna.version.version.expected,
+                   dna.version.generation.got,
+                   dna.version.version.got);
+        stream->close();
+        return;
+    }
+
+    // Add placeholders for all meshes that will be loaded on demand
+    const auto meshPositions = archive.getSkippedMeshPositions();
+    dna.geometry.meshes.reserve(meshPositions.size());
+    deferredMeshes.reserve(meshPositions.size());
+    for (const auto position : meshPositions) {
+        dna.geometry.meshes.emplace_back(memRes);
+        deferredMeshes.emplace_back(position, memRes);
+    }
+    behaviorPending = true;
+    deferred = true;
+}
+
+// Each deferred load resets the status (just as read does), and if it fails, the partially loaded data is discarded
+// and left pending, so the error remains observable through the status, and the load is attempted again on next access
+void LazyBinaryStreamReaderImpl::ensureBehaviorLoaded() const {
+    if (!behaviorPending) {
+        return;
+    }
+    status.reset();
+    archive.loadBehavior(loadable->behavior);
+    if (!sc::Status::isOk()) {
+        loadable->unloadBehavior();
+        return;
+    }
+    behaviorPending = false;
+}
+
+void LazyBinaryStreamReaderImpl::ensureMeshLoaded(std::uint16_t meshIndex) const {
+    if ((meshIndex >= deferredMeshes.size()) || deferredMeshes[meshIndex].loaded) {
+        return;
+    }
+    auto& deferredMesh = deferredMeshes[meshIndex];
+    auto& mesh = loadable->geometry.meshes[meshIndex];
+    status.reset();
+    const auto blendShapeTargetsPosition = archive.loadMesh(mesh, deferredMesh.position);
+    if (!sc::Status::isOk()) {
+        // Blend shape targets are loaded separately, so they are kept
+        auto blendShapeTargets = std::move(mesh.blendShapeTargets);
+        mesh = RawMesh{memRes};
+        mesh.blendShapeTargets = std::move(blendShapeTargets);
+        return;
+    }
+    deferredMesh.blendShapeTargetsPosition = blendShapeTargetsPosition;
+    deferredMesh.loaded = true;
+}
+
+void LazyBinaryStreamReaderImpl::ensureBlendShapeTargetsLoaded(std::uint16_t meshIndex) const {
+    if ((meshIndex >= deferredMeshes.size()) || deferredMeshes[meshIndex].blendShapeTargetsLoaded) {
+        return;
+    }
+    auto& deferredMesh = deferredMeshes[meshIndex];
+    auto& mesh = loadable->geometry.meshes[meshIndex];
+    if (meshIndex < dna.index.meshes.size()) {
+        // With an index available, only placeholders are created for now, and each blend shape target is loaded
+        // separately, when its data is first accessed
+        const auto& channelIndices = dna.index.meshes[meshIndex].blendShapeChannelIndices;
+        mesh.blendShapeTargets.clear();
+        mesh.blendShapeTargets.reserve(channelIndices.size());
+        for (const auto channelIndex : channelIndices) {
+            mesh.blendShapeTargets.emplace_back(memRes);
+            mesh.blendShapeTargets.back().blendShapeChannelIndex = channelIndex;
+        }
+        deferredMesh.pendingBlendShapeTargets.assign(channelIndices.size(), std::uint8_t{1});
+        deferredMesh.blendShapeTargetsLoaded = true;
+        return;
+    }
+    // Otherwise, the position of blend shape targets is known only after the rest of the mesh was loaded
+    ensureMeshLoaded(meshIndex);
+    if (!deferredMesh.loaded) {
+        return;
+    }
+    status.reset();
+    archive.loadBlendShapeTargets(mesh, deferredMesh.blendShapeTargetsPosition);
+    if (!sc::Status::isOk()) {
+        mesh.blendShapeTargets.clear();
+        return;
+    }
+    deferredMesh.blendShapeTargetsLoaded = true;
+}
+
+void LazyBinaryStreamReaderImpl::ensureBlendShapeTargetLoaded(std::uint16_t meshIndex,
+                                                              std::uint16_t blendShapeTargetIndex) const {
+    ensureBlendShapeTargetsLoaded(meshIndex);
+    if (meshIndex >= deferredMeshes.size()) {
+        return;
+    }
+    auto& pending = deferredMeshes[meshIndex].pendingBlendShapeTargets;
+    if ((blendShapeTargetIndex >= pending.size()) || (pending[blendShapeTargetIndex] == 0u)) {
+        return;
+    }
+    auto& blendShapeTarget = loadable->geometry.meshes[meshIndex].blendShapeTargets[blendShapeTargetIndex];
+    const auto& positions = dna.index.meshes[meshIndex].blendShapeTargetPositions;
+    status.reset();
+    archive.loadBlendShapeTarget(blendShapeTarget, positions[blendShapeTargetIndex]);
+    if (!sc::Status::isOk()) {
+        const auto channelIndex = dna.index.meshes[meshIndex].blendShapeChannelIndices[blendShapeTargetIndex];
+        blendShapeTarget = RawBlendShapeTarget{memRes};
+        blendShapeTarget.blendShapeChannelIndex = channelIndex;
+        return;
+    }
+    pending[blendShapeTargetIndex] = 0u;
+}
+
+ConstArrayView<std::uint16_t> LazyBinaryStreamReaderImpl::getGUIToRawInputIndices() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getGUIToRawInputIndices();
+}
+
+ConstArrayView<std::uint16_t> LazyBinaryStreamReaderImpl::getGUIToRawOutputIndices() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getGUIToRawOutputIndices();
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getGUIToRawFromValues() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getGUIToRawFromValues();
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getGUIToRawToValues() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getGUIToRawToValues();
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getGUIToRawSlopeValues() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getGUIToRawSlopeValues();
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getGUIToRawCutValues() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getGUIToRawCutValues();
+}
+
+std::uint16_t LazyBinaryStreamReaderImpl::getPSDCount() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getPSDCount();
+}
+
+ConstArrayView<std::uint16_t> LazyBinaryStreamReaderImpl::getPSDRowIndices() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getPSDRowIndices();
+}
+
+ConstArrayView<std::uint16_t> LazyBinaryStreamReaderImpl::getPSDColumnIndices() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getPSDColumnIndices();
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getPSDValues() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getPSDValues();
+}
+
+std::uint16_t LazyBinaryStreamReaderImpl::getJointRowCount() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getJointRowCount();
+}
+
+std::uint16_t LazyBinaryStreamReaderImpl::getJointColumnCount() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getJointColumnCount();
+}
+
+ConstArrayView<std::uint16_t> LazyBinaryStreamReaderImpl::getJointVariableAttributeIndices(std::uint16_t lod) const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getJointVariableAttributeIndices(lod);
+}
+
+std::uint16_t LazyBinaryStreamReaderImpl::getJointGroupCount() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getJointGroupCount();
+}
+
+ConstArrayView<std::uint16_t> LazyBinaryStreamReaderImpl::getJointGroupLODs(std::uint16_t jointGroupIndex) const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getJointGroupLODs(jointGroupIndex);
+}
+
+ConstArrayView<std::uint16_t> LazyBinaryStreamReaderImpl::getJointGroupInputIndices(std::uint16_t jointGroupIndex) const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getJointGroupInputIndices(jointGroupIndex);
+}
+
+ConstArrayView<std::uint16_t> LazyBinaryStreamReaderImpl::getJointGroupOutputIndices(std::uint16_t jointGroupIndex) const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getJointGroupOutputIndices(jointGroupIndex);
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getJointGroupValues(std::uint16_t jointGroupIndex) const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getJointGroupValues(jointGroupIndex);
+}
+
+ConstArrayView<std::uint16_t> LazyBinaryStreamReaderImpl::getJointGroupJointIndices(std::uint16_t jointGroupIndex) const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getJointGroupJointIndices(jointGroupIndex);
+}
+
+ConstArrayView<std::uint16_t> LazyBinaryStreamReaderImpl::getBlendShapeChannelLODs() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getBlendShapeChannelLODs();
+}
+
+ConstArrayView<std::uint16_t> LazyBinaryStreamReaderImpl::getBlendShapeChannelOutputIndices() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getBlendShapeChannelOutputIndices();
+}
+
+ConstArrayView<std::uint16_t> LazyBinaryStreamReaderImpl::getBlendShapeChannelInputIndices() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getBlendShapeChannelInputIndices();
+}
+
+ConstArrayView<std::uint16_t> LazyBinaryStreamReaderImpl::getAnimatedMapLODs() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getAnimatedMapLODs();
+}
+
+ConstArrayView<std::uint16_t> LazyBinaryStreamReaderImpl::getAnimatedMapInputIndices() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getAnimatedMapInputIndices();
+}
+
+ConstArrayView<std::uint16_t> LazyBinaryStreamReaderImpl::getAnimatedMapOutputIndices() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getAnimatedMapOutputIndices();
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getAnimatedMapFromValues() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getAnimatedMapFromValues();
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getAnimatedMapToValues() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getAnimatedMapToValues();
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getAnimatedMapSlopeValues() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getAnimatedMapSlopeValues();
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getAnimatedMapCutValues() const {
+    ensureBehaviorLoaded();
+    return ReaderImpl::getAnimatedMapCutValues();
+}
+
+std::uint32_t LazyBinaryStreamReaderImpl::getVertexPositionCount(std::uint16_t meshIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getVertexPositionCount(meshIndex);
+}
+
+Position LazyBinaryStreamReaderImpl::getVertexPosition(std::uint16_t meshIndex, std::uint32_t vertexIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getVertexPosition(meshIndex, vertexIndex);
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getVertexPositionXs(std::uint16_t meshIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getVertexPositionXs(meshIndex);
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getVertexPositionYs(std::uint16_t meshIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getVertexPositionYs(meshIndex);
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getVertexPositionZs(std::uint16_t meshIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getVertexPositionZs(meshIndex);
+}
+
+std::uint32_t LazyBinaryStreamReaderImpl::getVertexTextureCoordinateCount(std::uint16_t meshIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getVertexTextureCoordinateCount(meshIndex);
+}
+
+TextureCoordinate LazyBinaryStreamReaderImpl::getVertexTextureCoordinate(std::uint16_t meshIndex,
+                                                                         std::uint32_t textureCoordinateIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getVertexTextureCoordinate(meshIndex, textureCoordinateIndex);
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getVertexTextureCoordinateUs(std::uint16_t meshIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getVertexTextureCoordinateUs(meshIndex);
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getVertexTextureCoordinateVs(std::uint16_t meshIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getVertexTextureCoordinateVs(meshIndex);
+}
+
+std::uint32_t LazyBinaryStreamReaderImpl::getVertexNormalCount(std::uint16_t meshIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getVertexNormalCount(meshIndex);
+}
+
+Normal LazyBinaryStreamReaderImpl::getVertexNormal(std::uint16_t meshIndex, std::uint32_t normalIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getVertexNormal(meshIndex, normalIndex);
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getVertexNormalXs(std::uint16_t meshIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getVertexNormalXs(meshIndex);
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getVertexNormalYs(std::uint16_t meshIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getVertexNormalYs(meshIndex);
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getVertexNormalZs(std::uint16_t meshIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getVertexNormalZs(meshIndex);
+}
+
+std::uint32_t LazyBinaryStreamReaderImpl::getFaceCount(std::uint16_t meshIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getFaceCount(meshIndex);
+}
+
+ConstArrayView<std::uint32_t> LazyBinaryStreamReaderImpl::getFaceVertexLayoutIndices(std::uint16_t meshIndex,
+                                                                                     std::uint32_t faceIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getFaceVertexLayoutIndices(meshIndex, faceIndex);
+}
+
+std::uint32_t LazyBinaryStreamReaderImpl::getVertexLayoutCount(std::uint16_t meshIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getVertexLayoutCount(meshIndex);
+}
+
+VertexLayout LazyBinaryStreamReaderImpl::getVertexLayout(std::uint16_t meshIndex, std::uint32_t layoutIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getVertexLayout(meshIndex, layoutIndex);
+}
+
+ConstArrayView<std::uint32_t> LazyBinaryStreamReaderImpl::getVertexLayoutPositionIndices(std::uint16_t meshIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getVertexLayoutPositionIndices(meshIndex);
+}
+
+ConstArrayView<std::uint32_t> LazyBinaryStreamReaderImpl::getVertexLayoutTextureCoordinateIndices(std::uint16_t meshIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getVertexLayoutTextureCoordinateIndices(meshIndex);
+}
+
+ConstArrayView<std::uint32_t> LazyBinaryStreamReaderImpl::getVertexLayoutNormalIndices(std::uint16_t meshIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getVertexLayoutNormalIndices(meshIndex);
+}
+
+std::uint16_t LazyBinaryStreamReaderImpl::getMaximumInfluencePerVertex(std::uint16_t meshIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getMaximumInfluencePerVertex(meshIndex);
+}
+
+std::uint32_t LazyBinaryStreamReaderImpl::getSkinWeightsCount(std::uint16_t meshIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getSkinWeightsCount(meshIndex);
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getSkinWeightsValues(std::uint16_t meshIndex, std::uint32_t vertexIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getSkinWeightsValues(meshIndex, vertexIndex);
+}
+
+ConstArrayView<std::uint16_t> LazyBinaryStreamReaderImpl::getSkinWeightsJointIndices(std::uint16_t meshIndex,
+                                                                                     std::uint32_t vertexIndex) const {
+    ensureMeshLoaded(meshIndex);
+    return ReaderImpl::getSkinWeightsJointIndices(meshIndex, vertexIndex);
+}
+
+std::uint16_t LazyBinaryStreamReaderImpl::getBlendShapeTargetCount(std::uint16_t meshIndex) const {
+    ensureBlendShapeTargetsLoaded(meshIndex);
+    return ReaderImpl::getBlendShapeTargetCount(meshIndex);
+}
+
+std::uint16_t LazyBinaryStreamReaderImpl::getBlendShapeChannelIndex(std::uint16_t meshIndex,
+                                                                    std::uint16_t blendShapeTargetIndex) const {
+    ensureBlendShapeTargetsLoaded(meshIndex);
+    return ReaderImpl::getBlendShapeChannelIndex(meshIndex, blendShapeTargetIndex);
+}
+
+std::uint32_t LazyBinaryStreamReaderImpl::getBlendShapeTargetDeltaCount(std::uint16_t meshIndex,
+                                                                        std::uint16_t blendShapeTargetIndex) const {
+    ensureBlendShapeTargetLoaded(meshIndex, blendShapeTargetIndex);
+    return ReaderImpl::getBlendShapeTargetDeltaCount(meshIndex, blendShapeTargetIndex);
+}
+
+Delta LazyBinaryStreamReaderImpl::getBlendShapeTargetDelta(std::uint16_t meshIndex,
+                                                           std::uint16_t blendShapeTargetIndex,
+                                                           std::uint32_t deltaIndex) const {
+    ensureBlendShapeTargetLoaded(meshIndex, blendShapeTargetIndex);
+    return ReaderImpl::getBlendShapeTargetDelta(meshIndex, blendShapeTargetIndex, deltaIndex);
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getBlendShapeTargetDeltaXs(std::uint16_t meshIndex,
+                                                                             std::uint16_t blendShapeTargetIndex) const {
+    ensureBlendShapeTargetLoaded(meshIndex, blendShapeTargetIndex);
+    return ReaderImpl::getBlendShapeTargetDeltaXs(meshIndex, blendShapeTargetIndex);
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getBlendShapeTargetDeltaYs(std::uint16_t meshIndex,
+                                                                             std::uint16_t blendShapeTargetIndex) const {
+    ensureBlendShapeTargetLoaded(meshIndex, blendShapeTargetIndex);
+    return ReaderImpl::getBlendShapeTargetDeltaYs(meshIndex, blendShapeTargetIndex);
+}
+
+ConstArrayView<float> LazyBinaryStreamReaderImpl::getBlendShapeTargetDeltaZs(std::uint16_t meshIndex,
+                                                                             std::uint16_t blendShapeTargetIndex) const {
+    ensureBlendShapeTargetLoaded(meshIndex, blendShapeTargetIndex);
+    return ReaderImpl::getBlendShapeTargetDeltaZs(meshIndex, blendShapeTargetIndex);
+}
+
+ConstArrayView<std::uint32_t> LazyBinaryStreamReaderImpl::getBlendShapeTargetVertexIndices(std::uint16_t meshIndex,
+                                                                                           std::uint16_t blendShapeTargetIndex)
+const {
+    ensureBlendShapeTargetLoaded(meshIndex, blendShapeTargetIndex);
+    return ReaderImpl::getBlendShapeTargetVertexIndices(meshIndex, blendShapeTargetIndex);
+}
+
+}  // namespace dna
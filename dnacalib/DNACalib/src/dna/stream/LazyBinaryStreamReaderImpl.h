@@ -0,0 +1,145 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "dna/LazyBinaryStreamReader.h"
+#include "dna/ReaderImpl.h"
+#include "dna/TypeDefs.h"
+#include "dna/stream/FilteredInputArchive.h"
+
+#include <status/Provider.h>
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <cstdint>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace dna {
+
+class LazyBinaryStreamReaderImpl : public ReaderImpl<LazyBinaryStreamReader> {
+    public:
+        LazyBinaryStreamReaderImpl(BoundedIOStream* stream_,
+                                   std::uint16_t maxLOD_,
+                                   std::uint16_t minLOD_,
+                                   MemoryResource* memRes_);
+
+        void unload(DataLayer layer) override;
+        void read() override;
+
+        // BehaviorReader methods start
+        ConstArrayView<std::uint16_t> getGUIToRawInputIndices() const override;
+        ConstArrayView<std::uint16_t> getGUIToRawOutputIndices() const override;
+        ConstArrayView<float> getGUIToRawFromValues() const override;
+        ConstArrayView<float> getGUIToRawToValues() const override;
+        ConstArrayView<float> getGUIToRawSlopeValues() const override;
+        ConstArrayView<float> getGUIToRawCutValues() const override;
+        std::uint16_t getPSDCount() const override;
+        ConstArrayView<std::uint16_t> getPSDRowIndices() const override;
+        ConstArrayView<std::uint16_t> getPSDColumnIndices() const override;
+        ConstArrayView<float> getPSDValues() const override;
+        std::uint16_t getJointRowCount() const override;
+        std::uint16_t getJointColumnCount() const override;
+        ConstArrayView<std::uint16_t> getJointVariableAttributeIndices(std::uint16_t lod) const override;
+        std::uint16_t getJointGroupCount() const override;
+        ConstArrayView<std::uint16_t> getJointGroupLODs(std::uint16_t jointGroupIndex) const override;
+        ConstArrayView<std::uint16_t> getJointGroupInputIndices(std::uint16_t jointGroupIndex) const override;
+        ConstArrayView<std::uint16_t> getJointGroupOutputIndices(std::uint16_t jointGroupIndex) const override;
+        ConstArrayView<float> getJointGroupValues(std::uint16_t jointGroupIndex) const override;
+        ConstArrayView<std::uint16_t> getJointGroupJointIndices(std::uint16_t jointGroupIndex) const override;
+        ConstArrayView<std::uint16_t> getBlendShapeChannelLODs() const override;
+        ConstArrayView<std::uint16_t> getBlendShapeChannelOutputIndices() const override;
+        ConstArrayView<std::uint16_t> getBlendShapeChannelInputIndices() const override;
+        ConstArrayView<std::uint16_t> getAnimatedMapLODs() const override;
+        ConstArrayView<std::uint16_t> getAnimatedMapInputIndices() const override;
+        ConstArrayView<std::uint16_t> getAnimatedMapOutputIndices() const override;
+        ConstArrayView<float> getAnimatedMapFromValues() const override;
+        ConstArrayView<float> getAnimatedMapToValues() const override;
+        ConstArrayView<float> getAnimatedMapSlopeValues() const override;
+        ConstArrayView<float> getAnimatedMapCutValues() const override;
+
+        // GeometryReader methods start
+        std::uint32_t getVertexPositionCount(std::uint16_t meshIndex) const override;
+        Position getVertexPosition(std::uint16_t meshIndex, std::uint32_t vertexIndex) const override;
+        ConstArrayView<float> getVertexPositionXs(std::uint16_t meshIndex) const override;
+        ConstArrayView<float> getVertexPositionYs(std::uint16_t meshIndex) const override;
+        ConstArrayView<float> getVertexPositionZs(std::uint16_t meshIndex) const override;
+        std::uint32_t getVertexTextureCoordinateCount(std::uint16_t meshIndex) const override;
+        TextureCoordinate getVertexTextureCoordinate(std::uint16_t meshIndex,
+                                                     std::uint32_t textureCoordinateIndex) const override;
+        ConstArrayView<float> getVertexTextureCoordinateUs(std::uint16_t meshIndex) const override;
+        ConstArrayView<float> getVertexTextureCoordinateVs(std::uint16_t meshIndex) const override;
+        std::uint32_t getVertexNormalCount(std::uint16_t meshIndex) const override;
+        Normal getVertexNormal(std::uint16_t meshIndex, std::uint32_t normalIndex) const override;
+        ConstArrayView<float> getVertexNormalXs(std::uint16_t meshIndex) const override;
+        ConstArrayView<float> getVertexNormalYs(std::uint16_t meshIndex) const override;
+        ConstArrayView<float> getVertexNormalZs(std::uint16_t meshIndex) const override;
+        std::uint32_t getFaceCount(std::uint16_t meshIndex) const override;
+        ConstArrayView<std::uint32_t> getFaceVertexLayoutIndices(std::uint16_t meshIndex, std::uint32_t faceIndex) const override;
+        std::uint32_t getVertexLayoutCount(std::uint16_t meshIndex) const override;
+        VertexLayout getVertexLayout(std::uint16_t meshIndex, std::uint32_t layoutIndex) const override;
+        ConstArrayView<std::uint32_t> getVertexLayoutPositionIndices(std::uint16_t meshIndex) const override;
+        ConstArrayView<std::uint32_t> getVertexLayoutTextureCoordinateIndices(std::uint16_t meshIndex) const override;
+        ConstArrayView<std::uint32_t> getVertexLayoutNormalIndices(std::uint16_t meshIndex) const override;
+        std::uint16_t getMaximumInfluencePerVertex(std::uint16_t meshIndex) const override;
+        std::uint32_t getSkinWeightsCount(std::uint16_t meshIndex) const override;
+        ConstArrayView<float> getSkinWeightsValues(std::uint16_t meshIndex, std::uint32_t vertexIndex) const override;
+        ConstArrayView<std::uint16_t> getSkinWeightsJointIndices(std::uint16_t meshIndex,
+                                                                 std::uint32_t vertexIndex) const override;
+        std::uint16_t getBlendShapeTargetCount(std::uint16_t meshIndex) const override;
+        std::uint16_t getBlendShapeChannelIndex(std::uint16_t meshIndex, std::uint16_t blendShapeTargetIndex) const override;
+        std::uint32_t getBlendShapeTargetDeltaCount(std::uint16_t meshIndex, std::uint16_t blendShapeTargetIndex) const override;
+        Delta getBlendShapeTargetDelta(std::uint16_t meshIndex, std::uint16_t blendShapeTargetIndex,
+                                       std::uint32_t deltaIndex) const override;
+        ConstArrayView<float> getBlendShapeTargetDeltaXs(std::uint16_t meshIndex,
+                                                         std::uint16_t blendShapeTargetIndex) const override;
+        ConstArrayView<float> getBlendShapeTargetDeltaYs(std::uint16_t meshIndex,
+                                                         std::uint16_t blendShapeTargetIndex) const override;
+        ConstArrayView<float> getBlendShapeTargetDeltaZs(std::uint16_t meshIndex,
+                                                         std::uint16_t blendShapeTargetIndex) const override;
+        ConstArrayView<std::uint32_t> getBlendShapeTargetVertexIndices(std::uint16_t meshIndex,
+                                                                       std::uint16_t blendShapeTargetIndex) const override;
+
+    private:
+        void ensureBehaviorLoaded() const;
+        void ensureMeshLoaded(std::uint16_t meshIndex) const;
+        void ensureBlendShapeTargetsLoaded(std::uint16_t meshIndex) const;
+        void ensureBlendShapeTargetLoaded(std::uint16_t meshIndex, std::uint16_t blendShapeTargetIndex) const;
+
+    private:
+        struct DeferredMesh {
+            std::uint64_t position;
+            std::uint64_t blendShapeTargetsPosition;
+            bool loaded;
+            bool blendShapeTargetsLoaded;
+            // If the DNA has an index, blend shape targets are loaded one by one
+            Vector<std::uint8_t> pendingBlendShapeTargets;
+
+            DeferredMesh(std::uint64_t position_, MemoryResource* memRes) :
+                position{position_},
+                blendShapeTargetsPosition{},
+                loaded{false},
+                blendShapeTargetsLoaded{false},
+                pendingBlendShapeTargets{memRes} {
+            }
+
+        };
+
+    private:
+        static sc::StatusProvider status;
+
+        BoundedIOStream* stream;
+        // The DNA into which deferred data is loaded, as loading is triggered through const getters
+        DNA* loadable;
+        mutable FilteredInputArchive archive;
+        mutable Vector<DeferredMesh> deferredMeshes;
+        mutable bool behaviorPending;
+        // Whether the stream still holds data that may be loaded on demand
+        bool deferred;
+
+};
+
+}  // namespace dna
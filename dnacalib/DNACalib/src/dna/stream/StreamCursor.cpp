@@ -0,0 +1,161 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "dna/stream/StreamCursor.h"
+
+#include <status/Provider.h>
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <algorithm>
+#include <cstring>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace dna {
+
+namespace {
+
+// Only distances bounded by the buffer size are converted
+std::size_t toSize(std::uint64_t value) {
+    #if !defined(__clang__) && defined(__GNUC__)
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wuseless-cast"
+    #endif
+    const auto size = static_cast<std::size_t>(value);
+    #if !defined(__clang__) && defined(__GNUC__)
+        #pragma GCC diagnostic pop
+    #endif
+    return size;
+}
+
+}  // namespace
+
+StreamCursor::StreamCursor(BoundedIOStream* source_, std::mutex* sourceLock_, std::size_t bufferSize, MemoryResource* memRes) :
+    source{source_},
+    positionalSource{trio::PositionalReadable::find(source_)},
+    sourceLock{sourceLock_},
+    buffer{bufferSize, static_cast<char>(0), memRes},
+    sourceSize{source_->size()},
+    position{},
+    bufferStart{},
+    bufferFill{} {
+    if ((positionalSource != nullptr) && !positionalSource->canReadAt()) {
+        positionalSource = nullptr;
+    }
+}
+
+void StreamCursor::open() {
+    position = 0ul;
+}
+
+void StreamCursor::close() {
+    position = 0ul;
+}
+
+std::uint64_t StreamCursor::tell() {
+    return position;
+}
+
+void StreamCursor::seek(std::uint64_t position_) {
+    if (position_ <= sourceSize) {
+        position = position_;
+    } else {
+        status->set(SeekError);
+    }
+}
+
+std::uint64_t StreamCursor::size() {
+    return sourceSize;
+}
+
+std::size_t StreamCursor::read(char* destination, std::size_t size) {
+    if (destination == nullptr) {
+        status->set(ReadError);
+        return 0ul;
+    }
+
+    std::size_t bytesRead = 0ul;
+    while (bytesRead < size) {
+        const std::size_t remaining = size - bytesRead;
+        if ((remaining >= buffer.size()) && ((position < bufferStart) || (position >= bufferStart + bufferFill))) {
+            // Reads that would not fit into the buffer anyway bypass it
+            const std::size_t bytesCopied = readSource(destination + bytesRead, remaining);
+            bytesRead += bytesCopied;
+            position += bytesCopied;
+            break;
+        }
+        const std::size_t available = buffered();
+        if (available == 0ul) {
+            break;
+        }
+        const std::size_t bytesToCopy = std::min(remaining, available);
+        std::memcpy(destination + bytesRead, buffer.data() + toSize(position - bufferStart), bytesToCopy);
+        bytesRead += bytesToCopy;
+        position += bytesToCopy;
+    }
+    return bytesRead;
+}
+
+std::size_t StreamCursor::read(Writable* destination, std::size_t size) {
+    if (destination == nullptr) {
+        status->set(ReadError);
+        return 0ul;
+    }
+
+    std::size_t bytesRead = 0ul;
+    while (bytesRead < size) {
+        const std::size_t available = buffered();
+        if (available == 0ul) {
+            break;
+        }
+        const std::size_t bytesToCopy = std::min(size - bytesRead, available);
+        const char* start = buffer.data() + toSize(position - bufferStart);
+        const std::size_t bytesCopied = destination->write(start, bytesToCopy);
+        bytesRead += bytesCopied;
+        position += bytesCopied;
+        if (bytesCopied != bytesToCopy) {
+            break;
+        }
+    }
+    return bytesRead;
+}
+
+std::size_t StreamCursor::write(const char*  /*unused*/, std::size_t  /*unused*/) {
+    status->set(WriteError);
+    return 0ul;
+}
+
+std::size_t StreamCursor::write(Readable*  /*unused*/, std::size_t  /*unused*/) {
+    status->set(WriteError);
+    return 0ul;
+}
+
+std::size_t StreamCursor::buffered() {
+    if ((position < bufferStart) || (position >= bufferStart + bufferFill)) {
+        bufferStart = position;
+        const std::uint64_t capacity = buffer.size();
+        const auto bytesToRead = toSize(std::min(capacity, sourceSize - position));
+        bufferFill = readSource(buffer.data(), bytesToRead);
+    }
+    return bufferFill - toSize(position - bufferStart);
+}
+
+std::size_t StreamCursor::readSource(char* destination, std::size_t size) {
+    if (size == 0ul) {
+        return 0ul;
+    }
+    if (positionalSource != nullptr) {
+        return positionalSource->readAt(position, destination, size);
+    }
+    std::lock_guard<std::mutex> lock{*sourceLock};
+    source->seek(position);
+    if (!sc::Status::isOk()) {
+        return 0ul;
+    }
+    return source->read(destination, size);
+}
+
+}  // namespace dna
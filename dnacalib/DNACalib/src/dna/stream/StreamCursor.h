@@ -0,0 +1,60 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "dna/TypeDefs.h"
+
+#include <trio/Stream.h>
+#include <trio/streams/PositionalReadable.h>
+#include <trio/streams/StreamStatus.h>
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace dna {
+
+// A read-only stream over the contents of another stream, with a position of its own, so multiple instances may read
+// different parts of the same stream concurrently. Streams that support positional reads are read independently by
+// each instance, while any other stream is repositioned before each access, which is serialized through the given
+// mutex. Reads are served from a buffer of the given size in between.
+class StreamCursor : public BoundedIOStream {
+    public:
+        StreamCursor(BoundedIOStream* source_, std::mutex* sourceLock_, std::size_t bufferSize, MemoryResource* memRes);
+
+        void open() override;
+        void close() override;
+        std::uint64_t tell() override;
+        void seek(std::uint64_t position_) override;
+        std::uint64_t size() override;
+        std::size_t read(char* destination, std::size_t size) override;
+        std::size_t read(Writable* destination, std::size_t size) override;
+        std::size_t write(const char* source_, std::size_t size) override;
+        std::size_t write(Readable* source_, std::size_t size) override;
+
+    private:
+        // Ensures the buffer holds data at the current position, returning the number of bytes available from there
+        std::size_t buffered();
+        std::size_t readSource(char* destination, std::size_t size);
+
+    private:
+        trio::StreamStatus status;
+        BoundedIOStream* source;
+        // Null if the source can only be read from its own position
+        trio::PositionalReadable* positionalSource;
+        std::mutex* sourceLock;
+        Vector<char> buffer;
+        std::uint64_t sourceSize;
+        std::uint64_t position;
+        std::uint64_t bufferStart;
+        std::size_t bufferFill;
+};
+
+}  // namespace dna
@@ -14,6 +14,7 @@
 #include <functional>
 #include <iterator>
 #include <set>
+#include <utility>
 #include <vector>
 #ifdef _MSC_VER
     #pragma warning(pop)
@@ -70,6 +71,16 @@ inline void filter(TContainer& source, Predicate pred) {
     source.resize(newSize);
 }
 
+// Arrays referencing borrowed storage (e.g. the contents of a read-only memory mapped stream) must not be modified in
+// place, so their elements are copied into storage of their own first
+template<class TArray>
+inline void makeOwned(TArray& array) {
+    if (array.borrowed()) {
+        TArray copy{array};
+        array = std::move(copy);
+    }
+}
+
 namespace impl {
 
 enum class LUTStrategy {
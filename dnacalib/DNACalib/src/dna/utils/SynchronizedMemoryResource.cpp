@@ -0,0 +1,27 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "dna/utils/SynchronizedMemoryResource.h"
+
+namespace dna {
+
+SynchronizedMemoryResource::SynchronizedMemoryResource(MemoryResource* upstream_) :
+    // Without an upstream memory resource given, the same default memory resource is used as by PolyAllocator
+    upstream{PolyAllocator<char>{upstream_}.getMemoryResource()},
+    mutex{} {
+}
+
+void* SynchronizedMemoryResource::allocate(std::size_t size, std::size_t alignment) {
+    std::lock_guard<std::mutex> lock{mutex};
+    return upstream->allocate(size, alignment);
+}
+
+void SynchronizedMemoryResource::deallocate(void* ptr, std::size_t size, std::size_t alignment) {
+    std::lock_guard<std::mutex> lock{mutex};
+    upstream->deallocate(ptr, size, alignment);
+}
+
+MemoryResource* SynchronizedMemoryResource::getUpstreamMemoryResource() const {
+    return upstream;
+}
+
+}  // namespace dna
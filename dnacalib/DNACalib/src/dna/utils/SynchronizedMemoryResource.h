@@ -0,0 +1,33 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "dna/TypeDefs.h"
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <cstddef>
+#include <mutex>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace dna {
+
+// Serializes access to the upstream memory resource, so it can back memory resources used from multiple threads
+class SynchronizedMemoryResource : public MemoryResource {
+    public:
+        explicit SynchronizedMemoryResource(MemoryResource* upstream_);
+
+        void* allocate(std::size_t size, std::size_t alignment) override;
+        void deallocate(void* ptr, std::size_t size, std::size_t alignment) override;
+        MemoryResource* getUpstreamMemoryResource() const;
+
+    private:
+        MemoryResource* upstream;
+        std::mutex mutex;
+};
+
+}  // namespace dna
@@ -0,0 +1,59 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "dna/TypeDefs.h"
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <cstddef>
+#include <thread>
+#include <utility>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace dna {
+
+// Threads that are joined when the group goes out of scope, so none are left running (which would terminate the
+// process) if starting one of them, or anything done while they run, throws
+class ThreadGroup {
+    public:
+        explicit ThreadGroup(MemoryResource* memRes) : threads{memRes} {
+        }
+
+        ~ThreadGroup() {
+            join();
+        }
+
+        ThreadGroup(const ThreadGroup&) = delete;
+        ThreadGroup& operator=(const ThreadGroup&) = delete;
+
+        ThreadGroup(ThreadGroup&&) = delete;
+        ThreadGroup& operator=(ThreadGroup&&) = delete;
+
+        void reserve(std::size_t count) {
+            threads.reserve(count);
+        }
+
+        template<typename TFunction, typename ... TArgs>
+        void start(TFunction&& function, TArgs&& ... args) {
+            threads.emplace_back(std::forward<TFunction>(function), std::forward<TArgs>(args)...);
+        }
+
+        void join() {
+            for (auto& thread : threads) {
+                if (thread.joinable()) {
+                    thread.join();
+                }
+            }
+            threads.clear();
+        }
+
+    private:
+        Vector<std::thread> threads;
+};
+
+}  // namespace dna
@@ -4,6 +4,9 @@
 
 #include "dnacalib/CommandImplBase.h"
 #include "dnacalib/TypeDefs.h"
+#include "dnacalib/dna/DNACalibDNAReaderImpl.h"
+
+#include <status/Provider.h>
 
 namespace dnac {
 
@@ -14,13 +17,74 @@ class CommandSequence::Impl : public CommandImplBase<Impl> {
     public:
         explicit Impl(MemoryResource* memRes_) :
             Super{memRes_},
-            commands{memRes_} {
+            commands{memRes_},
+            transactional{false},
+            target{nullptr},
+            targetIdentity{},
+            snapshot{nullptr} {
         }
 
         void run(DNACalibDNAReader* output) {
-            for (auto& cmd : commands) {
-                cmd->run(output);
+            if (transactional) {
+                // The DNA passed to an earlier run may not exist anymore, so it's only touched if it's run again, which
+                // is told by its identity, as a new DNA may be allocated at the address of a destroyed one
+                auto outputImpl = static_cast<DNACalibDNAReaderImpl*>(output);
+                if ((outputImpl == target) && (outputImpl->getIdentity() == targetIdentity)) {
+                    commit();
+                } else {
+                    discard();
+                }
+                target = outputImpl;
+                targetIdentity = outputImpl->getIdentity();
+                snapshot.reset(DNACalibDNAReader::clone(output));
+            }
+            for (std::size_t i = 0ul; i < commands.size(); ++i) {
+                ScopedAllocationTag tag{"command", i};
+                if (transactional) {
+                    // Not all commands report their status, so one left from before must not be taken as their failure
+                    sc::StatusProvider::reset();
+                }
+                commands[i]->run(output);
+                if (transactional && !Status::isOk()) {
+                    rollback();
+                    return;
+                }
+            }
+        }
+
+        void setTransactional(bool transactional_) {
+            transactional = transactional_;
+            if (!transactional) {
+                discard();
+            }
+        }
+
+        bool isTransactional() const {
+            return transactional;
+        }
+
+        bool rollback() {
+            if (!snapshot) {
+                return false;
             }
+            target->restoreFrom(*static_cast<DNACalibDNAReaderImpl*>(snapshot.get()));
+            commit();
+            return true;
+        }
+
+        void commit() {
+            if (target == nullptr) {
+                return;
+            }
+            auto committed = target;
+            discard();
+            // With the state from before the run gone, the arrays it shared are used by the DNA alone again
+            committed->releaseSharedArrays();
+        }
+
+        void discard() {
+            snapshot.reset();
+            target = nullptr;
         }
 
         void add(Command* command) {
@@ -44,6 +108,11 @@ class CommandSequence::Impl : public CommandImplBase<Impl> {
 
     private:
         Vector<Command*> commands;
+        bool transactional;
+        // The DNA passed to the last run in transactional mode, and its state from before that run
+        DNACalibDNAReaderImpl* target;
+        std::uint64_t targetIdentity;
+        ScopedPtr<DNACalibDNAReader> snapshot;
 };
 
 CommandSequence::CommandSequence(MemoryResource* memRes) :
@@ -86,4 +155,20 @@ std::size_t CommandSequence::size() const {
     return pImpl->size();
 }
 
+void CommandSequence::setTransactional(bool transactional) {
+    pImpl->setTransactional(transactional);
+}
+
+bool CommandSequence::isTransactional() const {
+    return pImpl->isTransactional();
+}
+
+bool CommandSequence::rollback() {
+    return pImpl->rollback();
+}
+
+void CommandSequence::commit() {
+    pImpl->commit();
+}
+
 }  // namespace dnac
@@ -27,8 +27,8 @@ class RenameAnimatedMapCommand::Impl : public RenameResourceCommand<Impl> {
             return input->getAnimatedMapCount();
         }
 
-        StringView getNameByIndex(const dna::Reader* input, std::uint16_t index_) const override {
-            return input->getAnimatedMapName(index_);
+        std::uint16_t getIndexByName(const dna::Reader* input, const char* name) const override {
+            return dna::getAnimatedMapIndexByName(input, name);
         }
 
         void setNameByIndex(dna::Writer* output, std::uint16_t index_, const char* name) override {
@@ -27,8 +27,8 @@ class RenameJointCommand::Impl : public RenameResourceCommand<Impl> {
             return input->getJointCount();
         }
 
-        StringView getNameByIndex(const dna::Reader* input, std::uint16_t index_) const override {
-            return input->getJointName(index_);
+        std::uint16_t getIndexByName(const dna::Reader* input, const char* name) const override {
+            return dna::getJointIndexByName(input, name);
         }
 
         void setNameByIndex(dna::Writer* output, std::uint16_t index_, const char* name) override {
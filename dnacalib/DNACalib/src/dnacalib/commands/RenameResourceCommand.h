@@ -61,12 +61,9 @@ class RenameResourceCommand : public CommandImplBase<TDerived> {
 
     private:
         void searchAndRename(DNACalibDNAReaderImpl* output) {
-            for (std::uint16_t i = 0u; i < getNameCount(output); ++i) {
-                const auto name = getNameByIndex(output, i);
-                if (name == oldName) {
-                    setNameByIndex(output, i, newName.c_str());
-                    return;
-                }
+            const auto index_ = getIndexByName(output, oldName.c_str());
+            if (index_ < getNameCount(output)) {
+                setNameByIndex(output, index_, newName.c_str());
             }
         }
 
@@ -75,7 +72,7 @@ class RenameResourceCommand : public CommandImplBase<TDerived> {
         }
 
         virtual std::uint16_t getNameCount(const dna::Reader* input) const = 0;
-        virtual StringView getNameByIndex(const dna::Reader* input, std::uint16_t index_) const = 0;
+        virtual std::uint16_t getIndexByName(const dna::Reader* input, const char* name) const = 0;
         virtual void setNameByIndex(dna::Writer* output, std::uint16_t index_, const char* name) = 0;
 
     private:
@@ -24,18 +24,7 @@ class SetLODsCommand::Impl : public CommandImplBase<Impl> {
         }
 
         void run(DNACalibDNAReaderImpl* output) {
-            auto buffer = makeScoped<MemoryStream>(getMemoryResource());
-            auto writer = makeScoped<BinaryStreamWriter>(buffer.get(), getMemoryResource());
-            writer->setFrom(output);
-            writer->write();
-            buffer->seek(0ul);
-            auto reader = makeScoped<BinaryStreamReader>(buffer.get(),
-                                                         DataLayer::All,
-                                                         lods.data(),
-                                                         static_cast<std::uint16_t>(lods.size()),
-                                                         getMemoryResource());
-            reader->read();
-            output->setFrom(reader.get());
+            output->setLODs({lods.data(), lods.size()});
         }
 
     private:
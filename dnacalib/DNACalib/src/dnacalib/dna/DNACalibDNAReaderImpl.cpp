@@ -3,14 +3,284 @@
 #include "dnacalib/dna/DNACalibDNAReaderImpl.h"
 
 #include "dnacalib/TypeDefs.h"
+#include "dnacalib/dna/LODConstraint.h"
 #include "dnacalib/dna/filters/AnimatedMapFilter.h"
 #include "dnacalib/dna/filters/BlendShapeFilter.h"
 #include "dnacalib/dna/filters/JointFilter.h"
 #include "dnacalib/dna/filters/MeshFilter.h"
 #include "dnacalib/utils/Extd.h"
 
+#include "dna/stream/BinaryStreamReaderImpl.h"
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <atomic>
+#include <cstdint>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
 namespace dnac {
 
+static constexpr std::uint16_t jointAttributeCount = 9u;
+
+namespace {
+
+std::uint64_t nextIdentity() {
+    static std::atomic<std::uint64_t> lastIdentity{0ul};
+    return ++lastIdentity;
+}
+
+// The DNA structures of the dna and dnacalib libraries are laid out the same way, so data is handed over between them
+// container by container, which is a constant time operation, unless the data has to be copied, either because it's
+// borrowed from a memory mapped stream, or allocated from a different memory resource (e.g. the mesh arenas of a
+// reader that loaded meshes with multiple threads)
+class Adoption {
+    public:
+        Adoption(bool copy_, MemoryResource* memRes_) : copy{copy_}, memRes{memRes_} {
+        }
+
+        template<class TContainer>
+        void transfer(TContainer& source, TContainer& destination) const {
+            if (!copy && (source.get_allocator() == destination.get_allocator())) {
+                destination = std::move(source);
+            } else {
+                destination.assign(source.begin(), source.end());
+            }
+        }
+
+        template<class TArray>
+        void share(TArray& source, TArray& destination) const {
+            transfer(source, destination);
+        }
+
+        void transfer(dna::RawLODMapping& source, RawLODMapping& destination) const {
+            // Mappings are never borrowed, and always allocated from the memory resource of the whole DNA
+            Vector<std::uint16_t> lods{memRes};
+            Matrix<std::uint16_t> indices{memRes};
+            source.swap(lods, indices);
+            destination.swap(lods, indices);
+        }
+
+        void transfer(dna::RawSurjectiveMapping<std::uint16_t>& source, RawSurjectiveMapping<std::uint16_t>& destination) const {
+            Vector<std::uint16_t> from{memRes};
+            Vector<std::uint16_t> to{memRes};
+            source.swap(from, to);
+            destination.swap(from, to);
+        }
+
+    private:
+        bool copy;
+        MemoryResource* memRes;
+
+};
+
+// Copies all containers, except the sharable arrays, which the destination borrows from the same storage as the source
+class Cloning {
+    public:
+        template<class TContainer>
+        void transfer(TContainer& source, TContainer& destination) const {
+            destination = source;
+        }
+
+        template<class TArray>
+        void share(TArray& source, TArray& destination) const {
+            if (source.empty()) {
+                destination.clear();
+            } else {
+                destination.borrow(source.data(), source.size());
+            }
+        }
+
+};
+
+// Moves all containers between readers of the same memory resource
+class Restoration {
+    public:
+        template<class TContainer>
+        void transfer(TContainer& source, TContainer& destination) const {
+            destination = std::move(source);
+        }
+
+        template<class TArray>
+        void share(TArray& source, TArray& destination) const {
+            destination = std::move(source);
+        }
+
+};
+
+}  // namespace
+
+// Visits the same arrays that are shared by the transfer functions below
+template<class TVisitor>
+static void visitSharedArrays(RawVector3Vector& source, TVisitor& visitor) {
+    visitor(source.xs);
+    visitor(source.ys);
+    visitor(source.zs);
+}
+
+template<class TVisitor>
+static void visitSharedArrays(DNA& source, TVisitor& visitor) {
+    for (auto& jointGroup : source.behavior.joints.jointGroups) {
+        visitor(jointGroup.values);
+    }
+    for (auto& mesh : source.geometry.meshes) {
+        visitSharedArrays(mesh.positions, visitor);
+        visitor(mesh.textureCoordinates.us);
+        visitor(mesh.textureCoordinates.vs);
+        visitSharedArrays(mesh.normals, visitor);
+        visitor(mesh.layouts.positions);
+        visitor(mesh.layouts.textureCoordinates);
+        visitor(mesh.layouts.normals);
+        for (auto& blendShapeTarget : mesh.blendShapeTargets) {
+            visitSharedArrays(blendShapeTarget.deltas, visitor);
+            visitor(blendShapeTarget.vertexIndices);
+        }
+    }
+}
+
+template<class TSource, class TPolicy>
+static void transfer(TSource& source, RawStringTable& destination, TPolicy& policy) {
+    policy.transfer(source.characters, destination.characters);
+    policy.transfer(source.offsets, destination.offsets);
+}
+
+template<class TSource, class TPolicy>
+static void transfer(TSource& source, RawVector3Vector& destination, TPolicy& policy) {
+    policy.transfer(source.xs, destination.xs);
+    policy.transfer(source.ys, destination.ys);
+    policy.transfer(source.zs, destination.zs);
+}
+
+template<class TSource, class TPolicy>
+static void share(TSource& source, RawVector3Vector& destination, TPolicy& policy) {
+    policy.share(source.xs, destination.xs);
+    policy.share(source.ys, destination.ys);
+    policy.share(source.zs, destination.zs);
+}
+
+template<typename T, class TSource, class TPolicy>
+static void transfer(TSource& source, RawJaggedArray<T>& destination, TPolicy& policy) {
+    policy.transfer(source.values, destination.values);
+    policy.transfer(source.offsets, destination.offsets);
+}
+
+template<class TSource, class TPolicy>
+static void transfer(TSource& source, RawConditionalTable& destination, TPolicy& policy) {
+    policy.transfer(source.inputIndices, destination.inputIndices);
+    policy.transfer(source.outputIndices, destination.outputIndices);
+    policy.transfer(source.fromValues, destination.fromValues);
+    policy.transfer(source.toValues, destination.toValues);
+    policy.transfer(source.slopeValues, destination.slopeValues);
+    policy.transfer(source.cutValues, destination.cutValues);
+}
+
+template<class TSource, class TPolicy>
+static void transfer(TSource& source, RawDescriptor& destination, TPolicy& policy) {
+    policy.transfer(source.name, destination.name);
+    destination.archetype = source.archetype;
+    destination.gender = source.gender;
+    destination.age = source.age;
+    policy.transfer(source.metadata, destination.metadata);
+    destination.translationUnit = source.translationUnit;
+    destination.rotationUnit = source.rotationUnit;
+    destination.coordinateSystem.xAxis = source.coordinateSystem.xAxis;
+    destination.coordinateSystem.yAxis = source.coordinateSystem.yAxis;
+    destination.coordinateSystem.zAxis = source.coordinateSystem.zAxis;
+    destination.lodCount = source.lodCount;
+    destination.maxLOD = source.maxLOD;
+    policy.transfer(source.complexity, destination.complexity);
+    policy.transfer(source.dbName, destination.dbName);
+}
+
+template<class TSource, class TPolicy>
+static void transfer(TSource& source, RawDefinition& destination, TPolicy& policy) {
+    policy.transfer(source.lodJointMapping, destination.lodJointMapping);
+    policy.transfer(source.lodBlendShapeMapping, destination.lodBlendShapeMapping);
+    policy.transfer(source.lodAnimatedMapMapping, destination.lodAnimatedMapMapping);
+    policy.transfer(source.lodMeshMapping, destination.lodMeshMapping);
+    transfer(source.guiControlNames, destination.guiControlNames, policy);
+    transfer(source.rawControlNames, destination.rawControlNames, policy);
+    transfer(source.jointNames, destination.jointNames, policy);
+    transfer(source.blendShapeChannelNames, destination.blendShapeChannelNames, policy);
+    transfer(source.animatedMapNames, destination.animatedMapNames, policy);
+    transfer(source.meshNames, destination.meshNames, policy);
+    policy.transfer(source.meshBlendShapeChannelMapping, destination.meshBlendShapeChannelMapping);
+    policy.transfer(source.jointHierarchy, destination.jointHierarchy);
+    transfer(source.neutralJointTranslations, destination.neutralJointTranslations, policy);
+    transfer(source.neutralJointRotations, destination.neutralJointRotations, policy);
+}
+
+template<class TSource, class TPolicy>
+static void transfer(TSource& source, RawBehavior& destination, TPolicy& policy, MemoryResource* memRes) {
+    destination.controls.psdCount = source.controls.psdCount;
+    transfer(source.controls.conditionals, destination.controls.conditionals, policy);
+    policy.transfer(source.controls.psds.rows, destination.controls.psds.rows);
+    policy.transfer(source.controls.psds.columns, destination.controls.psds.columns);
+    policy.transfer(source.controls.psds.values, destination.controls.psds.values);
+
+    destination.joints.rowCount = source.joints.rowCount;
+    destination.joints.colCount = source.joints.colCount;
+    auto& jointGroups = destination.joints.jointGroups;
+    jointGroups.clear();
+    ensureHasSize(jointGroups, source.joints.jointGroups.size(), memRes);
+    for (std::size_t i = 0ul; i < jointGroups.size(); ++i) {
+        auto& jointGroup = source.joints.jointGroups[i];
+        policy.transfer(jointGroup.lods, jointGroups[i].lods);
+        policy.transfer(jointGroup.inputIndices, jointGroups[i].inputIndices);
+        policy.transfer(jointGroup.outputIndices, jointGroups[i].outputIndices);
+        policy.share(jointGroup.values, jointGroups[i].values);
+        policy.transfer(jointGroup.jointIndices, jointGroups[i].jointIndices);
+    }
+
+    policy.transfer(source.blendShapeChannels.lods, destination.blendShapeChannels.lods);
+    policy.transfer(source.blendShapeChannels.inputIndices, destination.blendShapeChannels.inputIndices);
+    policy.transfer(source.blendShapeChannels.outputIndices, destination.blendShapeChannels.outputIndices);
+
+    policy.transfer(source.animatedMaps.lods, destination.animatedMaps.lods);
+    transfer(source.animatedMaps.conditionals, destination.animatedMaps.conditionals, policy);
+}
+
+template<class TSource, class TPolicy>
+static void transfer(TSource& source, RawMesh& destination, TPolicy& policy, MemoryResource* memRes) {
+    share(source.positions, destination.positions, policy);
+    policy.share(source.textureCoordinates.us, destination.textureCoordinates.us);
+    policy.share(source.textureCoordinates.vs, destination.textureCoordinates.vs);
+    share(source.normals, destination.normals, policy);
+    policy.share(source.layouts.positions, destination.layouts.positions);
+    policy.share(source.layouts.textureCoordinates, destination.layouts.textureCoordinates);
+    policy.share(source.layouts.normals, destination.layouts.normals);
+    transfer(source.faces.layoutIndices, destination.faces.layoutIndices, policy);
+    destination.maximumInfluencePerVertex = source.maximumInfluencePerVertex;
+    transfer(source.skinWeights.weights, destination.skinWeights.weights, policy);
+    transfer(source.skinWeights.jointIndices, destination.skinWeights.jointIndices, policy);
+
+    auto& blendShapeTargets = destination.blendShapeTargets;
+    blendShapeTargets.clear();
+    ensureHasSize(blendShapeTargets, source.blendShapeTargets.size(), memRes);
+    for (std::size_t i = 0ul; i < blendShapeTargets.size(); ++i) {
+        auto& blendShapeTarget = source.blendShapeTargets[i];
+        share(blendShapeTarget.deltas, blendShapeTargets[i].deltas, policy);
+        policy.share(blendShapeTarget.vertexIndices, blendShapeTargets[i].vertexIndices);
+        blendShapeTargets[i].blendShapeChannelIndex = blendShapeTarget.blendShapeChannelIndex;
+    }
+}
+
+template<class TSource, class TPolicy>
+static void transfer(TSource& source, DNA& destination, TPolicy& policy, MemoryResource* memRes) {
+    transfer(source.descriptor, destination.descriptor, policy);
+    transfer(source.definition, destination.definition, policy);
+    transfer(source.behavior, destination.behavior, policy, memRes);
+    auto& meshes = destination.geometry.meshes;
+    meshes.clear();
+    ensureHasSize(meshes, source.geometry.meshes.size(), memRes);
+    for (std::size_t i = 0ul; i < meshes.size(); ++i) {
+        transfer(source.geometry.meshes[i], meshes[i], policy, memRes);
+    }
+}
+
 DNACalibDNAReader::~DNACalibDNAReader() = default;
 
 DNACalibDNAReaderImpl::~DNACalibDNAReaderImpl() = default;
@@ -26,6 +296,23 @@ DNACalibDNAReader* DNACalibDNAReader::create(const dna::Reader* reader, MemoryRe
     return instance;
 }
 
+DNACalibDNAReader* DNACalibDNAReader::clone(DNACalibDNAReader* source) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    auto original = static_cast<DNACalibDNAReaderImpl*>(source);
+    auto instance = static_cast<DNACalibDNAReaderImpl*>(create(original->getMemoryResource()));
+    instance->cloneFrom(*original);
+    return instance;
+}
+
+DNACalibDNAReader* DNACalibDNAReader::adopt(dna::BinaryStreamReader* reader) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    auto source = static_cast<dna::BinaryStreamReaderImpl*>(reader);
+    auto instance = static_cast<DNACalibDNAReaderImpl*>(create(source->getMemoryResource()));
+    instance->adopt(source->getLoadedDNA(), source->isDataBorrowed());
+    source->unload(dna::DataLayer::All);
+    return instance;
+}
+
 void DNACalibDNAReader::destroy(DNACalibDNAReader* instance) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
     auto ptr = static_cast<DNACalibDNAReaderImpl*>(instance);
@@ -36,13 +323,124 @@ void DNACalibDNAReader::destroy(DNACalibDNAReader* instance) {
 DNACalibDNAReaderImpl::DNACalibDNAReaderImpl(MemoryResource* memRes_) :
     BaseImpl{memRes_},
     ReaderImpl{memRes_},
-    WriterImpl{memRes_} {
+    WriterImpl{memRes_},
+    sharedArrays{memRes_},
+    identity{nextIdentity()} {
+}
+
+void DNACalibDNAReaderImpl::adopt(dna::DNA& source, bool borrowed) {
+    Adoption adoption{borrowed, memRes};
+    transfer(source, dna, adoption, memRes);
+}
+
+void DNACalibDNAReaderImpl::cloneFrom(DNACalibDNAReaderImpl& source) {
+    // Arrays that the source doesn't share yet (with earlier clones) are moved into shared storage, after which the
+    // clone references exactly the same arrays as the source
+    SharedArrays::Update sharing{source.sharedArrays, SharedArrays::Update::Mode::Share};
+    visitSharedArrays(source.dna, sharing);
+    sharedArrays.assign(source.sharedArrays);
+
+    Cloning cloning;
+    transfer(source.dna, dna, cloning, memRes);
+}
+
+void DNACalibDNAReaderImpl::restoreFrom(DNACalibDNAReaderImpl& source) {
+    Restoration restoration;
+    transfer(source.dna, dna, restoration, memRes);
+    // Arrays that only the replaced DNA borrowed are released right away
+    sharedArrays.assign(source.sharedArrays);
+
+    cache.reset();
+}
+
+void DNACalibDNAReaderImpl::releaseSharedArrays() {
+    SharedArrays::Update releasing{sharedArrays, SharedArrays::Update::Mode::Reclaim};
+    visitSharedArrays(dna, releasing);
+}
+
+std::uint64_t DNACalibDNAReaderImpl::getIdentity() const {
+    return identity;
 }
 
 void DNACalibDNAReaderImpl::setLODCount(std::uint16_t lodCount) {
     dna.descriptor.lodCount = lodCount;
 }
 
+void DNACalibDNAReaderImpl::clearGUIControlNames() {
+    WriterImpl::clearGUIControlNames();
+    cache.guiControlNameIndex.reset();
+}
+
+void DNACalibDNAReaderImpl::setGUIControlName(std::uint16_t index, const char* name) {
+    WriterImpl::setGUIControlName(index, name);
+    cache.guiControlNameIndex.reset();
+}
+
+void DNACalibDNAReaderImpl::clearRawControlNames() {
+    WriterImpl::clearRawControlNames();
+    cache.rawControlNameIndex.reset();
+}
+
+void DNACalibDNAReaderImpl::setRawControlName(std::uint16_t index, const char* name) {
+    WriterImpl::setRawControlName(index, name);
+    cache.rawControlNameIndex.reset();
+}
+
+void DNACalibDNAReaderImpl::clearJointNames() {
+    WriterImpl::clearJointNames();
+    cache.jointNameIndex.reset();
+}
+
+void DNACalibDNAReaderImpl::setJointName(std::uint16_t index, const char* name) {
+    WriterImpl::setJointName(index, name);
+    cache.jointNameIndex.reset();
+}
+
+void DNACalibDNAReaderImpl::clearBlendShapeChannelNames() {
+    WriterImpl::clearBlendShapeChannelNames();
+    cache.blendShapeChannelNameIndex.reset();
+}
+
+void DNACalibDNAReaderImpl::setBlendShapeChannelName(std::uint16_t index, const char* name) {
+    WriterImpl::setBlendShapeChannelName(index, name);
+    cache.blendShapeChannelNameIndex.reset();
+}
+
+void DNACalibDNAReaderImpl::clearAnimatedMapNames() {
+    WriterImpl::clearAnimatedMapNames();
+    cache.animatedMapNameIndex.reset();
+}
+
+void DNACalibDNAReaderImpl::setAnimatedMapName(std::uint16_t index, const char* name) {
+    WriterImpl::setAnimatedMapName(index, name);
+    cache.animatedMapNameIndex.reset();
+}
+
+void DNACalibDNAReaderImpl::clearMeshNames() {
+    WriterImpl::clearMeshNames();
+    cache.meshNameIndex.reset();
+}
+
+void DNACalibDNAReaderImpl::setMeshName(std::uint16_t index, const char* name) {
+    WriterImpl::setMeshName(index, name);
+    cache.meshNameIndex.reset();
+}
+
+void DNACalibDNAReaderImpl::copyDefinitionFrom(const dna::Reader* source, MemoryResource* memRes_) {
+    WriterImpl::copyDefinitionFrom(source, memRes_);
+    cache.resetNameIndices();
+}
+
+void DNACalibDNAReaderImpl::copyGeometryFrom(const dna::Reader* source, MemoryResource* memRes_) {
+    WriterImpl::copyGeometryFrom(source, memRes_);
+    releaseSharedArrays();
+}
+
+void DNACalibDNAReaderImpl::copyBlendShapeTargetsFrom(const dna::Reader* source, MemoryResource* memRes_) {
+    WriterImpl::copyBlendShapeTargetsFrom(source, memRes_);
+    releaseSharedArrays();
+}
+
 void DNACalibDNAReaderImpl::setNeutralJointTranslations(ConstArrayView<float> xs,
                                                         ConstArrayView<float> ys,
                                                         ConstArrayView<float> zs) {
@@ -88,9 +486,44 @@ void DNACalibDNAReaderImpl::setNeutralJointRotation(std::uint16_t index, const V
     dna.definition.neutralJointRotations.zs[index] = rotation.z;
 }
 
+void DNACalibDNAReaderImpl::clearJointGroups() {
+    WriterImpl::clearJointGroups();
+    releaseSharedArrays();
+}
+
+void DNACalibDNAReaderImpl::deleteJointGroup(std::uint16_t jointGroupIndex) {
+    WriterImpl::deleteJointGroup(jointGroupIndex);
+    releaseSharedArrays();
+}
+
+void DNACalibDNAReaderImpl::setJointGroupValues(std::uint16_t jointGroupIndex, const float* values, std::uint32_t count) {
+    ensureHasSize(dna.behavior.joints.jointGroups, jointGroupIndex + 1ul, memRes);
+    SharedArrays::Replacement replacement{sharedArrays, dna.behavior.joints.jointGroups[jointGroupIndex].values};
+    WriterImpl::setJointGroupValues(jointGroupIndex, values, count);
+}
+
 void DNACalibDNAReaderImpl::setJointGroupValues(std::uint16_t jointGroupIndex, AlignedDynArray<float>&& values) {
     ensureHasSize(dna.behavior.joints.jointGroups, jointGroupIndex + 1ul, memRes);
-    dna.behavior.joints.jointGroups[jointGroupIndex].values = std::move(values);
+    auto& destination = dna.behavior.joints.jointGroups[jointGroupIndex].values;
+    SharedArrays::Replacement replacement{sharedArrays, destination};
+    destination = std::move(values);
+}
+
+void DNACalibDNAReaderImpl::clearMeshes() {
+    WriterImpl::clearMeshes();
+    releaseSharedArrays();
+}
+
+void DNACalibDNAReaderImpl::deleteMesh(std::uint16_t meshIndex) {
+    WriterImpl::deleteMesh(meshIndex);
+    releaseSharedArrays();
+}
+
+void DNACalibDNAReaderImpl::setVertexPositions(std::uint16_t meshIndex, const Position* positions, std::uint32_t count) {
+    ensureHasSize(dna.geometry.meshes, meshIndex + 1ul, memRes);
+    const auto& destination = dna.geometry.meshes[meshIndex].positions;
+    SharedArrays::Replacement replacement{sharedArrays, destination.xs, destination.ys, destination.zs};
+    WriterImpl::setVertexPositions(meshIndex, positions, count);
 }
 
 void DNACalibDNAReaderImpl::setVertexPositions(std::uint16_t meshIndex,
@@ -98,14 +531,58 @@ void DNACalibDNAReaderImpl::setVertexPositions(std::uint16_t meshIndex,
                                                ConstArrayView<float> ys,
                                                ConstArrayView<float> zs) {
     ensureHasSize(dna.geometry.meshes, meshIndex + 1ul, memRes);
-    dna.geometry.meshes[meshIndex].positions.xs.assign(xs.begin(), xs.end());
-    dna.geometry.meshes[meshIndex].positions.ys.assign(ys.begin(), ys.end());
-    dna.geometry.meshes[meshIndex].positions.zs.assign(zs.begin(), zs.end());
+    auto& destination = dna.geometry.meshes[meshIndex].positions;
+    SharedArrays::Replacement replacement{sharedArrays, destination.xs, destination.ys, destination.zs};
+    destination.xs.assign(xs.begin(), xs.end());
+    destination.ys.assign(ys.begin(), ys.end());
+    destination.zs.assign(zs.begin(), zs.end());
 }
 
 void DNACalibDNAReaderImpl::setVertexPositions(std::uint16_t meshIndex, RawVector3Vector&& positions) {
     ensureHasSize(dna.geometry.meshes, meshIndex + 1ul, memRes);
-    dna.geometry.meshes[meshIndex].positions = std::move(positions);
+    auto& destination = dna.geometry.meshes[meshIndex].positions;
+    SharedArrays::Replacement replacement{sharedArrays, destination.xs, destination.ys, destination.zs};
+    destination = std::move(positions);
+}
+
+void DNACalibDNAReaderImpl::setVertexTextureCoordinates(std::uint16_t meshIndex,
+                                                        const TextureCoordinate* textureCoordinates,
+                                                        std::uint32_t count) {
+    ensureHasSize(dna.geometry.meshes, meshIndex + 1ul, memRes);
+    const auto& destination = dna.geometry.meshes[meshIndex].textureCoordinates;
+    SharedArrays::Replacement replacement{sharedArrays, destination.us, destination.vs};
+    WriterImpl::setVertexTextureCoordinates(meshIndex, textureCoordinates, count);
+}
+
+void DNACalibDNAReaderImpl::setVertexNormals(std::uint16_t meshIndex, const Normal* normals, std::uint32_t count) {
+    ensureHasSize(dna.geometry.meshes, meshIndex + 1ul, memRes);
+    const auto& destination = dna.geometry.meshes[meshIndex].normals;
+    SharedArrays::Replacement replacement{sharedArrays, destination.xs, destination.ys, destination.zs};
+    WriterImpl::setVertexNormals(meshIndex, normals, count);
+}
+
+void DNACalibDNAReaderImpl::setVertexLayouts(std::uint16_t meshIndex, const VertexLayout* layouts, std::uint32_t count) {
+    ensureHasSize(dna.geometry.meshes, meshIndex + 1ul, memRes);
+    const auto& destination = dna.geometry.meshes[meshIndex].layouts;
+    SharedArrays::Replacement replacement{sharedArrays, destination.positions, destination.textureCoordinates,
+                                          destination.normals};
+    WriterImpl::setVertexLayouts(meshIndex, layouts, count);
+}
+
+void DNACalibDNAReaderImpl::clearBlendShapeTargets(std::uint16_t meshIndex) {
+    WriterImpl::clearBlendShapeTargets(meshIndex);
+    releaseSharedArrays();
+}
+
+void DNACalibDNAReaderImpl::setBlendShapeTargetDeltas(std::uint16_t meshIndex,
+                                                      std::uint16_t blendShapeTargetIndex,
+                                                      const Delta* deltas,
+                                                      std::uint32_t count) {
+    ensureHasSize(dna.geometry.meshes, meshIndex + 1ul, memRes);
+    ensureHasSize(dna.geometry.meshes[meshIndex].blendShapeTargets, blendShapeTargetIndex + 1ul, memRes);
+    const auto& destination = dna.geometry.meshes[meshIndex].blendShapeTargets[blendShapeTargetIndex].deltas;
+    SharedArrays::Replacement replacement{sharedArrays, destination.xs, destination.ys, destination.zs};
+    WriterImpl::setBlendShapeTargetDeltas(meshIndex, blendShapeTargetIndex, deltas, count);
 }
 
 void DNACalibDNAReaderImpl::setBlendShapeTargetDeltas(std::uint16_t meshIndex,
@@ -115,9 +592,11 @@ void DNACalibDNAReaderImpl::setBlendShapeTargetDeltas(std::uint16_t meshIndex,
                                                       ConstArrayView<float> zs) {
     ensureHasSize(dna.geometry.meshes, meshIndex + 1ul, memRes);
     ensureHasSize(dna.geometry.meshes[meshIndex].blendShapeTargets, blendShapeTargetIndex + 1ul, memRes);
-    dna.geometry.meshes[meshIndex].blendShapeTargets[blendShapeTargetIndex].deltas.xs.assign(xs.begin(), xs.end());
-    dna.geometry.meshes[meshIndex].blendShapeTargets[blendShapeTargetIndex].deltas.ys.assign(ys.begin(), ys.end());
-    dna.geometry.meshes[meshIndex].blendShapeTargets[blendShapeTargetIndex].deltas.zs.assign(zs.begin(), zs.end());
+    auto& destination = dna.geometry.meshes[meshIndex].blendShapeTargets[blendShapeTargetIndex].deltas;
+    SharedArrays::Replacement replacement{sharedArrays, destination.xs, destination.ys, destination.zs};
+    destination.xs.assign(xs.begin(), xs.end());
+    destination.ys.assign(ys.begin(), ys.end());
+    destination.zs.assign(zs.begin(), zs.end());
 }
 
 void DNACalibDNAReaderImpl::setBlendShapeTargetDeltas(std::uint16_t meshIndex,
@@ -125,7 +604,16 @@ void DNACalibDNAReaderImpl::setBlendShapeTargetDeltas(std::uint16_t meshIndex,
                                                       RawVector3Vector&& deltas) {
     ensureHasSize(dna.geometry.meshes, meshIndex + 1ul, memRes);
     ensureHasSize(dna.geometry.meshes[meshIndex].blendShapeTargets, blendShapeTargetIndex + 1ul, memRes);
-    dna.geometry.meshes[meshIndex].blendShapeTargets[blendShapeTargetIndex].deltas = std::move(deltas);
+    auto& destination = dna.geometry.meshes[meshIndex].blendShapeTargets[blendShapeTargetIndex].deltas;
+    SharedArrays::Replacement replacement{sharedArrays, destination.xs, destination.ys, destination.zs};
+    destination = std::move(deltas);
+}
+
+void DNACalibDNAReaderImpl::setBlendShapeTargetVertexIndices(std::uint16_t meshIndex,
+                                                             std::uint16_t blendShapeTargetIndex,
+                                                             const std::uint32_t* vertexIndices,
+                                                             std::uint32_t count) {
+    setBlendShapeTargetVertexIndices(meshIndex, blendShapeTargetIndex, ConstArrayView<std::uint32_t>{vertexIndices, count});
 }
 
 void DNACalibDNAReaderImpl::setBlendShapeTargetVertexIndices(std::uint16_t meshIndex,
@@ -133,20 +621,35 @@ void DNACalibDNAReaderImpl::setBlendShapeTargetVertexIndices(std::uint16_t meshI
                                                              ConstArrayView<std::uint32_t> vertexIndices) {
     ensureHasSize(dna.geometry.meshes, meshIndex + 1ul, memRes);
     ensureHasSize(dna.geometry.meshes[meshIndex].blendShapeTargets, blendShapeTargetIndex + 1ul, memRes);
-    dna.geometry.meshes[meshIndex].blendShapeTargets[blendShapeTargetIndex].vertexIndices.assign(vertexIndices.begin(),
-                                                                                                 vertexIndices.end());
+    auto& destination = dna.geometry.meshes[meshIndex].blendShapeTargets[blendShapeTargetIndex].vertexIndices;
+    SharedArrays::Replacement replacement{sharedArrays, destination};
+    destination.assign(vertexIndices.begin(), vertexIndices.end());
 }
 
 void DNACalibDNAReaderImpl::pruneBlendShapeTargets(float threshold) {
     const float threshold2 = threshold * threshold;
     for (auto& mesh : dna.geometry.meshes) {
         for (auto& bst : mesh.blendShapeTargets) {
+            const auto passes = [&bst, threshold2](std::size_t i) {
+                    const float magnitude2 = (bst.deltas.xs[i] * bst.deltas.xs[i]) +
+                        (bst.deltas.ys[i] * bst.deltas.ys[i]) +
+                        (bst.deltas.zs[i] * bst.deltas.zs[i]);
+                    return (magnitude2 > threshold2);
+                };
             std::size_t di{};
-            for (std::size_t si{}; si < bst.deltas.size(); ++si) {
-                const float magnitude2 = (bst.deltas.xs[si] * bst.deltas.xs[si]) +
-                    (bst.deltas.ys[si] * bst.deltas.ys[si]) +
-                    (bst.deltas.zs[si] * bst.deltas.zs[si]);
-                if (magnitude2 > threshold2) {
+            while ((di < bst.deltas.size()) && passes(di)) {
+                ++di;
+            }
+            if (di == bst.deltas.size()) {
+                continue;
+            }
+            // Targets might be shared with clones, so they are written to only if anything is actually pruned
+            extd::makeOwned(bst.deltas.xs);
+            extd::makeOwned(bst.deltas.ys);
+            extd::makeOwned(bst.deltas.zs);
+            extd::makeOwned(bst.vertexIndices);
+            for (std::size_t si = di + 1ul; si < bst.deltas.size(); ++si) {
+                if (passes(si)) {
                     bst.deltas.xs[di] = bst.deltas.xs[si];
                     bst.deltas.ys[di] = bst.deltas.ys[si];
                     bst.deltas.zs[di] = bst.deltas.zs[si];
@@ -158,6 +661,7 @@ void DNACalibDNAReaderImpl::pruneBlendShapeTargets(float threshold) {
             bst.vertexIndices.resize(di);
         }
     }
+    releaseSharedArrays();
 }
 
 void DNACalibDNAReaderImpl::removeMeshes(ConstArrayView<std::uint16_t> meshIndices) {
@@ -179,6 +683,7 @@ void DNACalibDNAReaderImpl::removeMeshes(ConstArrayView<std::uint16_t> meshIndic
     // Repopulate cache of (mesh, blend shape) mapping per LOD
     cache.meshBlendShapeMappingIndices.reset();
     cache.populate(this);
+    releaseSharedArrays();
 }
 
 void DNACalibDNAReaderImpl::removeJoints(ConstArrayView<std::uint16_t> jointIndices) {
@@ -212,10 +717,9 @@ void DNACalibDNAReaderImpl::removeJoints(ConstArrayView<std::uint16_t> jointIndi
     jointFilter.apply(dna.behavior);
     // Remove skin weights related to this joint and normalize them
     for (auto& mesh : dna.geometry.meshes) {
-        for (auto& skinWeights : mesh.skinWeights) {
-            jointFilter.apply(skinWeights);
-        }
+        jointFilter.apply(mesh.skinWeights);
     }
+    releaseSharedArrays();
 }
 
 void DNACalibDNAReaderImpl::removeJointAnimations(ConstArrayView<std::uint16_t> jointIndices) {
@@ -229,6 +733,7 @@ void DNACalibDNAReaderImpl::removeJointAnimations(ConstArrayView<std::uint16_t>
                           std::move(allowedJointIndices),
                           JointFilter::Option::AnimationOnly);
     jointFilter.apply(dna.behavior);
+    releaseSharedArrays();
 }
 
 void DNACalibDNAReaderImpl::removeBlendShapes(ConstArrayView<std::uint16_t> blendShapeIndices) {
@@ -257,6 +762,7 @@ void DNACalibDNAReaderImpl::removeBlendShapes(ConstArrayView<std::uint16_t> blen
     for (auto& mesh : dna.geometry.meshes) {
         blendShapeFilter.apply(mesh);
     }
+    releaseSharedArrays();
 }
 
 void DNACalibDNAReaderImpl::removeAnimatedMaps(ConstArrayView<std::uint16_t> animatedMapIndices) {
@@ -282,4 +788,116 @@ void DNACalibDNAReaderImpl::removeAnimatedMaps(ConstArrayView<std::uint16_t> ani
     animatedMapFilter.apply(dna.behavior);
 }
 
+void DNACalibDNAReaderImpl::setLODs(ConstArrayView<std::uint16_t> lods) {
+    LODConstraint lodConstraint{lods, memRes};
+    const auto unconstrainedLODCount = dna.descriptor.lodCount;
+    lodConstraint.clampTo(unconstrainedLODCount);
+    if (!lodConstraint.hasImpactOn(unconstrainedLODCount)) {
+        return;
+    }
+    // Everything below follows the filtering done by the binary stream reader while loading with a LOD constraint
+    dna.descriptor.maxLOD = static_cast<std::uint16_t>(dna.descriptor.maxLOD + lodConstraint.getMaxLOD());
+    dna.descriptor.lodCount = lodConstraint.getLODCount();
+
+    auto& definition = dna.definition;
+    // To find joints that are not in any LOD, find the joints that are not in LOD 0 (the current max LOD, at index 0), as it
+    // contains joints from all lower LODs.
+    Vector<std::uint16_t> jointsNotInLOD0{memRes};
+    const auto jointIndicesForLOD0 = definition.lodJointMapping.getIndices(0);
+    for (std::uint16_t idx = 0; idx < definition.jointNames.size(); ++idx) {
+        if (std::find(jointIndicesForLOD0.begin(), jointIndicesForLOD0.end(), idx) == jointIndicesForLOD0.end()) {
+            jointsNotInLOD0.push_back(idx);
+        }
+    }
+
+    // Discard LOD data that is not relevant for the selected LODs
+    definition.lodMeshMapping.discardLODs(lodConstraint);
+    definition.lodJointMapping.discardLODs(lodConstraint);
+    definition.lodBlendShapeMapping.discardLODs(lodConstraint);
+    definition.lodAnimatedMapMapping.discardLODs(lodConstraint);
+
+    auto allowedJointIndices = definition.lodJointMapping.getCombinedDistinctIndices(memRes);
+    // In order to keep joints that are not in any LOD, add them all to the list of joints to keep when filtering.
+    allowedJointIndices.insert(jointsNotInLOD0.begin(), jointsNotInLOD0.end());
+    JointFilter jointFilter{memRes};
+    jointFilter.configure(static_cast<std::uint16_t>(definition.jointNames.size()), std::move(allowedJointIndices));
+
+    auto& behavior = dna.behavior;
+    lodConstraint.applyTo(behavior.blendShapeChannels.lods);
+    lodConstraint.applyTo(behavior.animatedMaps.lods);
+    BlendShapeFilter blendShapeFilter{memRes};
+    blendShapeFilter.configure(static_cast<std::uint16_t>(definition.blendShapeChannelNames.size()),
+                               definition.lodBlendShapeMapping.getCombinedDistinctIndices(memRes),
+                               Vector<std::uint16_t>{behavior.blendShapeChannels.lods.begin(),
+                                                     behavior.blendShapeChannels.lods.end(),
+                                                     memRes});
+    AnimatedMapFilter animatedMapFilter{memRes};
+    animatedMapFilter.configure(static_cast<std::uint16_t>(definition.animatedMapNames.size()),
+                                definition.lodAnimatedMapMapping.getCombinedDistinctIndices(memRes),
+                                Matrix<std::uint16_t>{memRes});
+    MeshFilter meshFilter{memRes};
+    meshFilter.configure(static_cast<std::uint16_t>(definition.meshNames.size()),
+                         definition.lodMeshMapping.getCombinedDistinctIndices(memRes));
+
+    meshFilter.apply(definition);
+    jointFilter.apply(definition);
+    blendShapeFilter.apply(definition);
+    animatedMapFilter.apply(definition);
+
+    // Rows are sorted by LOD, so rows of the selected LODs are those that remain within the row count of the first of them
+    for (auto& jointGroup : behavior.joints.jointGroups) {
+        lodConstraint.applyTo(jointGroup.lods);
+        const auto rowCount = (jointGroup.lods.empty() ? static_cast<std::uint16_t>(0) : jointGroup.lods[0]);
+        if (rowCount == 0u) {
+            jointGroup.inputIndices.clear();
+        }
+        const auto columnCount = jointGroup.inputIndices.size();
+        jointGroup.outputIndices.resize(rowCount);
+        // Remap joint attribute indices
+        for (auto& attrIdx : jointGroup.outputIndices) {
+            const auto jntIdx = static_cast<std::uint16_t>(attrIdx / jointAttributeCount);
+            const auto relAttrIdx = attrIdx - (jntIdx * jointAttributeCount);
+            attrIdx = static_cast<std::uint16_t>(jointFilter.remapped(jntIdx) * jointAttributeCount + relAttrIdx);
+        }
+        jointGroup.values.resize(rowCount * columnCount);
+        extd::filter(jointGroup.jointIndices, [&jointFilter](std::uint16_t jntIdx, std::size_t  /*unused*/) {
+                return jointFilter.passes(jntIdx);
+            });
+        for (auto& jntIdx : jointGroup.jointIndices) {
+            jntIdx = jointFilter.remapped(jntIdx);
+        }
+    }
+    const auto uncompressedJointCount = static_cast<std::uint16_t>(jointFilter.maxRemappedIndex() + 1u);
+    behavior.joints.rowCount = static_cast<std::uint16_t>(uncompressedJointCount * jointAttributeCount);
+
+    const auto blendShapeCount = (behavior.blendShapeChannels.lods.empty() ?
+                                  static_cast<std::uint16_t>(0) : behavior.blendShapeChannels.lods[0]);
+    behavior.blendShapeChannels.inputIndices.resize(blendShapeCount);
+    behavior.blendShapeChannels.outputIndices.resize(blendShapeCount);
+
+    const auto animatedMapCount = (behavior.animatedMaps.lods.empty() ?
+                                   static_cast<std::uint16_t>(0) : behavior.animatedMaps.lods[0]);
+    auto& conditionals = behavior.animatedMaps.conditionals;
+    conditionals.inputIndices.resize(animatedMapCount);
+    conditionals.outputIndices.resize(animatedMapCount);
+    conditionals.fromValues.resize(animatedMapCount);
+    conditionals.toValues.resize(animatedMapCount);
+    conditionals.slopeValues.resize(animatedMapCount);
+    conditionals.cutValues.resize(animatedMapCount);
+
+    extd::filter(dna.geometry.meshes, [&meshFilter](const RawMesh&  /*unused*/, std::size_t index) {
+            return meshFilter.passes(static_cast<std::uint16_t>(index));
+        });
+    for (auto& mesh : dna.geometry.meshes) {
+        jointFilter.apply(mesh.skinWeights);
+        extd::filter(mesh.blendShapeTargets, [&blendShapeFilter](const RawBlendShapeTarget& bsTarget, std::size_t  /*unused*/) {
+                return blendShapeFilter.passes(bsTarget.blendShapeChannelIndex);
+            });
+    }
+
+    // Everything derived from the filtered data is recomputed on demand
+    cache.reset();
+    releaseSharedArrays();
+}
+
 }  // namespace dnac
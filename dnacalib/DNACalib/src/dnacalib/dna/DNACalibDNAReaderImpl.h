@@ -4,11 +4,27 @@
 
 #include "dnacalib/dna/DNACalibDNAReader.h"
 #include "dnacalib/dna/ReaderImpl.h"
+#include "dnacalib/dna/SharedArrays.h"
 #include "dnacalib/dna/WriterImpl.h"
 
 #include <dna/Reader.h>
 #include <dna/Writer.h>
 
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <cstdint>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace dna {
+
+struct DNA;
+
+}  // namespace dna
+
 namespace dnac {
 
 class DNACalibDNAReaderImpl : public ReaderImpl<DNACalibDNAReader>, public WriterImpl<dna::Writer> {
@@ -23,9 +39,38 @@ class DNACalibDNAReaderImpl : public ReaderImpl<DNACalibDNAReader>, public Write
         DNACalibDNAReaderImpl(DNACalibDNAReaderImpl&&) = delete;
         DNACalibDNAReaderImpl& operator=(DNACalibDNAReaderImpl&&) = delete;
 
+        // Takes over the containers of the given DNA, copying only those which are borrowed (if so specified), or
+        // allocated from a different memory resource
+        void adopt(dna::DNA& source, bool borrowed);
+        // Copies the DNA of the given reader, except for the mesh arrays, joint group values and blend shape targets,
+        // which are shared with it, until either reader replaces them with arrays of its own
+        void cloneFrom(DNACalibDNAReaderImpl& source);
+        // Takes over the DNA of the given reader (usually a clone of this one, made before it was modified), which is
+        // left empty, while the current DNA is discarded
+        void restoreFrom(DNACalibDNAReaderImpl& source);
+        // Drops references to shared arrays that are no longer borrowed, and takes back ownership of those which are no
+        // longer shared with any other reader
+        void releaseSharedArrays();
+        // Unique among all readers created by the process, unlike their addresses, which are reused once they are freed
+        std::uint64_t getIdentity() const;
+
         using WriterImpl<dna::Writer>::setLODCount;
         void setLODCount(std::uint16_t lodCount);
 
+        // Name indices of the reader are reset whenever names change
+        void clearGUIControlNames() override;
+        void setGUIControlName(std::uint16_t index, const char* name) override;
+        void clearRawControlNames() override;
+        void setRawControlName(std::uint16_t index, const char* name) override;
+        void clearJointNames() override;
+        void setJointName(std::uint16_t index, const char* name) override;
+        void clearBlendShapeChannelNames() override;
+        void setBlendShapeChannelName(std::uint16_t index, const char* name) override;
+        void clearAnimatedMapNames() override;
+        void setAnimatedMapName(std::uint16_t index, const char* name) override;
+        void clearMeshNames() override;
+        void setMeshName(std::uint16_t index, const char* name) override;
+
         using WriterImpl<dna::Writer>::setNeutralJointTranslations;
         void setNeutralJointTranslations(ConstArrayView<float> xs, ConstArrayView<float> ys, ConstArrayView<float> zs);
         void setNeutralJointTranslations(RawVector3Vector&& translations);
@@ -36,17 +81,31 @@ class DNACalibDNAReaderImpl : public ReaderImpl<DNACalibDNAReader>, public Write
         void setNeutralJointRotations(RawVector3Vector&& rotations);
         void setNeutralJointRotation(std::uint16_t index, const Vector3& rotation);
 
-        using WriterImpl<dna::Writer>::setJointGroupValues;
+        // Shared arrays are released by the reader as soon as they are replaced (or removed)
+        void clearJointGroups() override;
+        void deleteJointGroup(std::uint16_t jointGroupIndex) override;
+        void setJointGroupValues(std::uint16_t jointGroupIndex, const float* values, std::uint32_t count) override;
         void setJointGroupValues(std::uint16_t jointGroupIndex, AlignedDynArray<float>&& values);
 
-        using WriterImpl<dna::Writer>::setVertexPositions;
+        void clearMeshes() override;
+        void deleteMesh(std::uint16_t meshIndex) override;
+        void setVertexTextureCoordinates(std::uint16_t meshIndex, const TextureCoordinate* textureCoordinates,
+                                         std::uint32_t count) override;
+        void setVertexNormals(std::uint16_t meshIndex, const Normal* normals, std::uint32_t count) override;
+        void setVertexLayouts(std::uint16_t meshIndex, const VertexLayout* layouts, std::uint32_t count) override;
+        void clearBlendShapeTargets(std::uint16_t meshIndex) override;
+
+        void setVertexPositions(std::uint16_t meshIndex, const Position* positions, std::uint32_t count) override;
         void setVertexPositions(std::uint16_t meshIndex,
                                 ConstArrayView<float> xs,
                                 ConstArrayView<float> ys,
                                 ConstArrayView<float> zs);
         void setVertexPositions(std::uint16_t meshIndex, RawVector3Vector&& positions);
 
-        using WriterImpl<dna::Writer>::setBlendShapeTargetDeltas;
+        void setBlendShapeTargetDeltas(std::uint16_t meshIndex,
+                                       std::uint16_t blendShapeTargetIndex,
+                                       const Delta* deltas,
+                                       std::uint32_t count) override;
         void setBlendShapeTargetDeltas(std::uint16_t meshIndex,
                                        std::uint16_t blendShapeTargetIndex,
                                        ConstArrayView<float> xs,
@@ -54,7 +113,10 @@ class DNACalibDNAReaderImpl : public ReaderImpl<DNACalibDNAReader>, public Write
                                        ConstArrayView<float> zs);
         void setBlendShapeTargetDeltas(std::uint16_t meshIndex, std::uint16_t blendShapeTargetIndex, RawVector3Vector&& deltas);
 
-        using WriterImpl<dna::Writer>::setBlendShapeTargetVertexIndices;
+        void setBlendShapeTargetVertexIndices(std::uint16_t meshIndex,
+                                              std::uint16_t blendShapeTargetIndex,
+                                              const std::uint32_t* vertexIndices,
+                                              std::uint32_t count) override;
         void setBlendShapeTargetVertexIndices(std::uint16_t meshIndex, std::uint16_t blendShapeTargetIndex,
                                               ConstArrayView<std::uint32_t> vertexIndices);
 
@@ -65,6 +127,17 @@ class DNACalibDNAReaderImpl : public ReaderImpl<DNACalibDNAReader>, public Write
         void removeJointAnimations(ConstArrayView<std::uint16_t> jointIndex);
         void removeBlendShapes(ConstArrayView<std::uint16_t> blendShapeIndices);
         void removeAnimatedMaps(ConstArrayView<std::uint16_t> animatedMapIndices);
+        // Keeps only the given LODs, with the same result as if the DNA was loaded with them as the LOD constraint
+        void setLODs(ConstArrayView<std::uint16_t> lods);
+
+        // Name indices of the reader are reset when names are copied from another reader as well
+        void copyDefinitionFrom(const dna::Reader* source, MemoryResource* memRes) override;
+        void copyGeometryFrom(const dna::Reader* source, MemoryResource* memRes) override;
+        void copyBlendShapeTargetsFrom(const dna::Reader* source, MemoryResource* memRes) override;
+
+    private:
+        SharedArrays sharedArrays;
+        std::uint64_t identity;
 
 };
 
@@ -6,19 +6,36 @@
 #include "dnacalib/types/Aliases.h"
 #include "dnacalib/utils/Extd.h"
 
+#include "dna/NameIndex.h"
+
 #include <cassert>
 #include <cstdint>
 
 namespace dnac {
 
+using dna::NameIndex;
+
 template<class Reader>
 struct DenormalizedData {
     LODMapping jointVariableAttributeIndices;
     LODMapping meshBlendShapeMappingIndices;
+    // Built on first lookup by name
+    NameIndex guiControlNameIndex;
+    NameIndex rawControlNameIndex;
+    NameIndex jointNameIndex;
+    NameIndex blendShapeChannelNameIndex;
+    NameIndex animatedMapNameIndex;
+    NameIndex meshNameIndex;
 
     explicit DenormalizedData(MemoryResource* memRes) :
         jointVariableAttributeIndices{memRes},
-        meshBlendShapeMappingIndices{memRes} {
+        meshBlendShapeMappingIndices{memRes},
+        guiControlNameIndex{memRes},
+        rawControlNameIndex{memRes},
+        jointNameIndex{memRes},
+        blendShapeChannelNameIndex{memRes},
+        animatedMapNameIndex{memRes},
+        meshNameIndex{memRes} {
     }
 
     void populate(const Reader* source) {
@@ -26,6 +43,22 @@ struct DenormalizedData {
         populateMeshBlendShapeMappingIndices(source, meshBlendShapeMappingIndices);
     }
 
+    // Everything derived from the DNA is recomputed on demand
+    void reset() {
+        jointVariableAttributeIndices.reset();
+        meshBlendShapeMappingIndices.reset();
+        resetNameIndices();
+    }
+
+    void resetNameIndices() {
+        guiControlNameIndex.reset();
+        rawControlNameIndex.reset();
+        jointNameIndex.reset();
+        blendShapeChannelNameIndex.reset();
+        animatedMapNameIndex.reset();
+        meshNameIndex.reset();
+    }
+
     private:
         void populateJointVariableAttributeIndices(const dna::Reader* source, LODMapping& destination) {
             // Prepare storage for all available LODs
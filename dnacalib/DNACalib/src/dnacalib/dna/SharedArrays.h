@@ -0,0 +1,164 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "dnacalib/TypeDefs.h"
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace dnac {
+
+// References to the storage of arrays that a reader shares with its clones (or the reader it was cloned from).
+// Each shared array is moved into reference counted storage of its own, which all readers sharing it borrow its
+// elements from, while each of them references the storage of exactly those arrays it borrows, keyed by the address
+// of their elements. A reader drops its reference as soon as it stops borrowing an array, so each array is freed once
+// no reader uses it anymore.
+class SharedArrays {
+    private:
+        using References = UnorderedMap<const void*, std::shared_ptr<void> >;
+
+    public:
+        // Rebuilds the references of a reader from the arrays it currently consists of, which are passed to it one by one,
+        // dropping the references to arrays that are no longer borrowed
+        class Update {
+            public:
+                enum class Mode {
+                    // Arrays that are not shared yet are moved into shared storage, to be borrowed by a clone
+                    Share,
+                    // Arrays that no other reader shares anymore are moved back into the array itself
+                    Reclaim
+                };
+
+            public:
+                Update(SharedArrays& owner_, Mode mode_) :
+                    owner{owner_},
+                    mode{mode_},
+                    previous{owner_.memRes} {
+
+                    previous.swap(owner.references);
+                }
+
+                template<class TArray>
+                void operator()(TArray& array) {
+                    if (array.empty()) {
+                        return;
+                    }
+                    if (!array.borrowed()) {
+                        if (mode == Mode::Share) {
+                            owner.share(array);
+                        }
+                        return;
+                    }
+                    auto it = previous.find(array.data());
+                    if (it == previous.end()) {
+                        return;
+                    }
+                    if ((mode == Mode::Reclaim) && (it->second.use_count() == 1l)) {
+                        array = std::move(*std::static_pointer_cast<TArray>(it->second));
+                    } else {
+                        owner.references.insert(std::move(*it));
+                    }
+                }
+
+            private:
+                SharedArrays& owner;
+                Mode mode;
+                // References that are not carried over are dropped along with the update
+                References previous;
+
+        };
+
+        // Releases the storage that the given arrays borrow when it's constructed, as they are replaced by the time it's
+        // destroyed
+        class Replacement {
+            private:
+                static constexpr std::size_t maxArrayCount = 3ul;
+
+            public:
+                template<class ... TArrays>
+                explicit Replacement(SharedArrays& owner_, const TArrays& ... arrays) :
+                    owner{owner_},
+                    previous{{borrowedBy(arrays) ...}} {
+                    static_assert(sizeof...(TArrays) <= maxArrayCount, "Too many arrays replaced at once.");
+                }
+
+                ~Replacement() {
+                    for (const auto data : previous) {
+                        owner.release(data);
+                    }
+                }
+
+                Replacement(const Replacement&) = delete;
+                Replacement& operator=(const Replacement&) = delete;
+
+                Replacement(Replacement&&) = delete;
+                Replacement& operator=(Replacement&&) = delete;
+
+            private:
+                SharedArrays& owner;
+                std::array<const void*, maxArrayCount> previous;
+
+        };
+
+    public:
+        explicit SharedArrays(MemoryResource* memRes_) : memRes{memRes_}, references{memRes_} {
+        }
+
+        SharedArrays(const SharedArrays&) = delete;
+        SharedArrays& operator=(const SharedArrays&) = delete;
+
+        SharedArrays(SharedArrays&&) = delete;
+        SharedArrays& operator=(SharedArrays&&) = delete;
+
+        // The address of the elements that the given array borrows from shared storage, if any
+        template<class TArray>
+        static const void* borrowedBy(const TArray& array) {
+            return (array.borrowed() ? static_cast<const void*>(array.data()) : nullptr);
+        }
+
+        // Drops the reference to the storage of the given elements, which the reader has replaced
+        void release(const void* data) {
+            if (data != nullptr) {
+                references.erase(data);
+            }
+        }
+
+        // References exactly the same arrays as the given reader, which may allocate from a different memory resource
+        void assign(const SharedArrays& rhs) {
+            references.clear();
+            references.insert(rhs.references.begin(), rhs.references.end());
+        }
+
+        std::size_t size() const {
+            return references.size();
+        }
+
+    private:
+        template<class TArray>
+        void share(TArray& array) {
+            auto storage = std::allocate_shared<TArray>(PolyAllocator<TArray>{memRes});
+            // The array keeps its allocator, should it allocate storage of its own again
+            TArray borrowing{array.get_allocator()};
+            *storage = std::move(array);
+            borrowing.borrow(storage->data(), storage->size());
+            array = std::move(borrowing);
+            references.emplace(storage->data(), std::move(storage));
+        }
+
+    private:
+        MemoryResource* memRes;
+        References references;
+
+};
+
+}  // namespace dnac
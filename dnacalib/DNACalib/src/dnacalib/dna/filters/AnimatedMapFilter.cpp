@@ -30,7 +30,7 @@ void AnimatedMapFilter::apply(RawDefinition& dest) {
             return remappedIndices.at(value);
         });
     // Delete elements that are not referenced by the new subset of LODs
-    extd::filter(dest.animatedMapNames, extd::byPosition(passingIndices));
+    dest.animatedMapNames.filter(extd::byPosition(passingIndices));
 }
 
 void AnimatedMapFilter::apply(RawBehavior& dest) {
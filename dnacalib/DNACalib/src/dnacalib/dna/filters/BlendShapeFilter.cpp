@@ -31,7 +31,7 @@ void BlendShapeFilter::apply(RawDefinition& dest) {
             return remappedIndices.at(value);
         });
     // Delete elements that are not referenced by the new subset of LODs
-    extd::filter(dest.blendShapeChannelNames, extd::byPosition(passingIndices));
+    dest.blendShapeChannelNames.filter(extd::byPosition(passingIndices));
     // Delete entries from other mappings that reference any of the deleted elements
     auto ignoredByLODConstraint = [this](std::uint16_t  /*unused*/, std::uint16_t blendShapeIndex) {
             return !extd::contains(passingIndices, blendShapeIndex);
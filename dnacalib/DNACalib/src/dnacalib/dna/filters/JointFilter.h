@@ -11,7 +11,7 @@ namespace dnac {
 struct RawBehavior;
 struct RawDefinition;
 struct RawLODMapping;
-struct RawVertexSkinWeights;
+struct RawSkinWeightsVector;
 
 class JointFilter {
     public:
@@ -25,7 +25,7 @@ class JointFilter {
         void configure(std::uint16_t jointCount, UnorderedSet<std::uint16_t> allowedJointIndices, Option option_ = Option::All);
         void apply(RawDefinition& dest);
         void apply(RawBehavior& dest);
-        void apply(RawVertexSkinWeights& dest);
+        void apply(RawSkinWeightsVector& dest);
         bool passes(std::uint16_t index) const;
         std::uint16_t remapped(std::uint16_t oldIndex) const;
         std::uint16_t maxRemappedIndex() const;
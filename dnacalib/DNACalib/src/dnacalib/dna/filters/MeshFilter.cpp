@@ -28,7 +28,7 @@ void MeshFilter::apply(RawDefinition& dest) {
             return remappedIndices.at(value);
         });
     // Delete elements that are not referenced by the new subset of LODs
-    extd::filter(dest.meshNames, extd::byPosition(passingIndices));
+    dest.meshNames.filter(extd::byPosition(passingIndices));
     // Delete entries from other mappings that reference any of the deleted elements
     auto ignoredByLODConstraint = [this](std::uint16_t meshIndex, std::uint16_t  /*unused*/) {
             return !extd::contains(passingIndices, meshIndex);
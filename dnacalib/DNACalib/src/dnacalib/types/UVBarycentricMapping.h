@@ -6,6 +6,18 @@
 #include "dnacalib/types/BoundingBox.h"
 #include "dnacalib/types/Triangle.h"
 
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
 namespace dnac {
 
 class UVBarycentricMapping {
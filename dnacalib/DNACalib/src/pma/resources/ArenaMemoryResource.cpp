@@ -5,6 +5,7 @@
 #include "pma/ScopedPtr.h"
 #include "pma/TypeDefs.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
@@ -42,10 +43,14 @@ class ArenaMemoryResource::Impl {
             regionSize{regionSize_},
             growthFactor{growthFactor_},
             upstream{upstream_},
-            ptr{nullptr} {
+            current{},
+            ptr{nullptr},
+            usedBeforeCurrent{},
+            peakUsedSize{} {
 
             assert(upstream != nullptr);
-            allocateArena(initialSize_);
+            arenas.push_back(allocateArena(initialSize_));
+            ptr = arenas.back().memory;
         }
 
         ~Impl() {
@@ -63,27 +68,17 @@ class ArenaMemoryResource::Impl {
 
         void* allocate(std::size_t size, std::size_t alignment) {
             auto pAligned = alignPointer(ptr, alignment);
-            // If the old(current) pointer equals the aligned pointer, it was already
-            // adhering to the given alignment requirement.
-            const auto alignmentCorrection = static_cast<std::size_t>(static_cast<char*>(pAligned) - static_cast<char*>(ptr));
-            const auto neededSize = size + alignmentCorrection;
             // Check if current arena has enough free space
-            assert(!arenas.empty());
-            const auto& currentArena = arenas.back();
-            if ((static_cast<char*>(ptr) + neededSize) > (static_cast<char*>(currentArena.memory) + currentArena.size)) {
-                // Not enough space in current arena, allocate an additional one (honoring growth factor),
-                // unless this is the first additional region that's needed, in which case it's size will
-                // be exactly `regionSize`
-                const bool isFirstAdditional = (arenas.size() == 1ul);
-                const std::size_t newArenaSize =
-                    (isFirstAdditional ? regionSize : static_cast<std::size_t>(std::lroundf(static_cast<float>(currentArena.size)
-                                                                                            * growthFactor)));
-                allocateArena(newArenaSize);
-                // Retry allocation relying on newly allocated arena
-                return allocate(size, alignment);
+            assert(current < arenas.size());
+            const auto& currentArena = arenas[current];
+            if ((static_cast<char*>(pAligned) + size) > (static_cast<char*>(currentArena.memory) + currentArena.size)) {
+                // Not enough space in current arena, continue in the next one
+                advance(size + alignment);
+                pAligned = alignPointer(ptr, alignment);
             }
 
-            ptr = static_cast<void*>(static_cast<char*>(ptr) + neededSize);
+            ptr = static_cast<void*>(static_cast<char*>(pAligned) + size);
+            peakUsedSize = std::max(peakUsedSize, getUsedSize());
             return pAligned;
         }
 
@@ -91,18 +86,31 @@ class ArenaMemoryResource::Impl {
             return upstream;
         }
 
-    private:
-        void allocateArena(std::size_t size) {
-            if (!arenas.empty() && (arenas.back().memory == ptr)) {
-                // No allocation happened in the arena whatsoever, and the first allocation was
-                // immediately larger than the arena's size, thus it's an unused arena, and should
-                // be discarded immediately.
-                auto unusedArena = arenas.back();
-                arenas.pop_back();
-                upstream->deallocate(unusedArena.memory, unusedArena.size, alignof(std::max_align_t));
+        Marker mark() const {
+            return {current, getCurrentOffset(), getUsedSize()};
+        }
+
+        void release(const Marker& marker) {
+            assert((marker.region < current) || ((marker.region == current) && (marker.offset <= getCurrentOffset())));
+            current = marker.region;
+            ptr = static_cast<void*>(static_cast<char*>(arenas[current].memory) + marker.offset);
+            usedBeforeCurrent = marker.usedSize - marker.offset;
+        }
+
+        std::size_t getUsedSize() const {
+            return usedBeforeCurrent + getCurrentOffset();
+        }
+
+        std::size_t getPeakUsedSize() const {
+            return peakUsedSize;
+        }
+
+        std::size_t getReservedSize() const {
+            std::size_t reservedSize = 0ul;
+            for (const auto& arena : arenas) {
+                reservedSize += arena.size;
             }
-            arenas.push_back({upstream->allocate(size, alignof(std::max_align_t)), size});
-            ptr = arenas.back().memory;
+            return reservedSize;
         }
 
     private:
@@ -111,11 +119,58 @@ class ArenaMemoryResource::Impl {
             std::size_t size;
         };
 
-        pma::List<Arena> arenas;
+    private:
+        // Moves on to the arena following the current one, making sure it has at least the needed size
+        void advance(std::size_t neededSize) {
+            // Additional arenas honor the growth factor, unless this is the first additional arena that's
+            // needed, in which case it's size will be exactly `regionSize`
+            const bool isFirstAdditional = (current == 0ul);
+            const std::size_t newArenaSize = std::max(neededSize,
+                                                      (isFirstAdditional ? regionSize :
+                                                       static_cast<std::size_t>(std::lroundf(static_cast<float>(arenas[current].size)
+                                                                                             * growthFactor))));
+            if (ptr == arenas[current].memory) {
+                // No allocation happened in the arena whatsoever, and the first allocation was
+                // immediately larger than the arena's size, thus it's an unused arena, and should
+                // be replaced immediately.
+                replaceArena(current, newArenaSize);
+            } else {
+                usedBeforeCurrent += getCurrentOffset();
+                ++current;
+                if (current == arenas.size()) {
+                    arenas.push_back(allocateArena(newArenaSize));
+                } else if (arenas[current].size < neededSize) {
+                    // Arenas kept from before the arena was rewound are reused, unless they are too small
+                    replaceArena(current, newArenaSize);
+                }
+            }
+            ptr = arenas[current].memory;
+        }
+
+        Arena allocateArena(std::size_t size) {
+            return {upstream->allocate(size, alignof(std::max_align_t)), size};
+        }
+
+        void replaceArena(std::size_t index, std::size_t size) {
+            upstream->deallocate(arenas[index].memory, arenas[index].size, alignof(std::max_align_t));
+            arenas[index] = allocateArena(size);
+        }
+
+        std::size_t getCurrentOffset() const {
+            return static_cast<std::size_t>(static_cast<char*>(ptr) - static_cast<char*>(arenas[current].memory));
+        }
+
+    private:
+        pma::Vector<Arena> arenas;
         std::size_t regionSize;
         float growthFactor;
         MemoryResource* upstream;
+        // Index of the arena from which allocations are currently served
+        std::size_t current;
         void* ptr;
+        // Number of bytes allocated from all arenas preceding the current one
+        std::size_t usedBeforeCurrent;
+        std::size_t peakUsedSize;
 
 };
 
@@ -150,4 +205,28 @@ MemoryResource* ArenaMemoryResource::getUpstreamMemoryResource() const {
     return pImpl->getUpstreamMemoryResource();
 }
 
+ArenaMemoryResource::Marker ArenaMemoryResource::mark() const {
+    return pImpl->mark();
+}
+
+void ArenaMemoryResource::release(const Marker& marker) {
+    pImpl->release(marker);
+}
+
+void ArenaMemoryResource::reset() {
+    pImpl->release({0ul, 0ul, 0ul});
+}
+
+std::size_t ArenaMemoryResource::getUsedSize() const {
+    return pImpl->getUsedSize();
+}
+
+std::size_t ArenaMemoryResource::getPeakUsedSize() const {
+    return pImpl->getPeakUsedSize();
+}
+
+std::size_t ArenaMemoryResource::getReservedSize() const {
+    return pImpl->getReservedSize();
+}
+
 }  // namespace pma
@@ -0,0 +1,281 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "pma/resources/PoolMemoryResource.h"
+
+#include "pma/ScopedPtr.h"
+#include "pma/TypeDefs.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace pma {
+
+namespace {
+
+constexpr std::size_t minBlockSize = 16ul;
+constexpr std::size_t maxSizeClassCount = 24ul;
+constexpr std::size_t maxCacheCount = 64ul;
+
+inline std::size_t roundUpToPowerOfTwo(std::size_t value) {
+    std::size_t result = 1ul;
+    while (result < value) {
+        result <<= 1ul;
+    }
+    return result;
+}
+
+inline std::size_t binaryLog(std::size_t powerOfTwo) {
+    std::size_t result = 0ul;
+    while (powerOfTwo > 1ul) {
+        powerOfTwo >>= 1ul;
+        ++result;
+    }
+    return result;
+}
+
+inline char* alignPointer(char* ptr, std::size_t alignment) {
+    const std::size_t mask = alignment - 1ul;
+    assert((alignment & mask) == 0ul);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(ptr);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast,performance-no-int-to-ptr)
+    return reinterpret_cast<char*>((address + mask) & ~mask);
+}
+
+// Threads are numbered in the order in which they first use any pool, so consecutive threads use different caches
+std::size_t currentThreadIndex() {
+    static std::atomic<std::size_t> threadCount{0ul};
+    thread_local static const std::size_t threadIndex = threadCount.fetch_add(1ul);
+    return threadIndex;
+}
+
+}  // namespace
+
+class PoolMemoryResource::Impl {
+    public:
+        static Impl* create(std::size_t maxBlockSize_, std::size_t chunkSize_, MemoryResource* upstream_) {
+            PolyAllocator<Impl> alloc{upstream_};
+            return alloc.newObject(maxBlockSize_, chunkSize_, upstream_);
+        }
+
+        static void destroy(Impl* instance) {
+            PolyAllocator<Impl> alloc{instance->upstream};
+            alloc.deleteObject(instance);
+        }
+
+        Impl(std::size_t maxBlockSize_, std::size_t chunkSize_, MemoryResource* upstream_) :
+            caches{std::min(std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), 1ul), maxCacheCount),
+                   upstream_},
+            maxBlockSize{std::min(roundUpToPowerOfTwo(std::max(maxBlockSize_, minBlockSize)),
+                                  minBlockSize << (maxSizeClassCount - 1ul))},
+            chunkSize{chunkSize_},
+            upstream{upstream_} {
+
+            assert(upstream != nullptr);
+        }
+
+        ~Impl() {
+            for (auto& cache : caches) {
+                while (cache.chunks != nullptr) {
+                    Chunk* chunk = cache.chunks;
+                    cache.chunks = chunk->next;
+                    upstream->deallocate(chunk, chunk->size, alignof(std::max_align_t));
+                }
+            }
+        }
+
+        Impl(const Impl&) = delete;
+        Impl& operator=(const Impl&) = delete;
+
+        Impl(Impl&&) = delete;
+        Impl& operator=(Impl&&) = delete;
+
+        void* allocate(std::size_t size, std::size_t alignment) {
+            if (std::max(size, alignment) > maxBlockSize) {
+                return upstream->allocate(size, alignment);
+            }
+            const std::size_t sizeClass = getSizeClass(size, alignment);
+
+            Cache& cache = getCache();
+            std::lock_guard<std::mutex> lock{cache.mutex};
+            FreeList& freeList = cache.freeLists[sizeClass];
+            if ((freeList.head == nullptr) && !takeShared(freeList, sizeClass) && !allocateChunk(cache, sizeClass)) {
+                return nullptr;
+            }
+            return freeList.pop();
+        }
+
+        void deallocate(void* ptr, std::size_t size, std::size_t alignment) {
+            if (ptr == nullptr) {
+                return;
+            }
+            if (std::max(size, alignment) > maxBlockSize) {
+                upstream->deallocate(ptr, size, alignment);
+                return;
+            }
+            const std::size_t sizeClass = getSizeClass(size, alignment);
+
+            Cache& cache = getCache();
+            std::lock_guard<std::mutex> lock{cache.mutex};
+            FreeList& freeList = cache.freeLists[sizeClass];
+            freeList.push(static_cast<Block*>(ptr));
+            // Blocks allocated by one thread and deallocated by another would otherwise pile up in the cache of the
+            // deallocating thread, while the allocating thread keeps allocating new chunks
+            if (freeList.count > 2ul * getBlocksPerChunk(sizeClass)) {
+                giveShared(freeList, sizeClass);
+            }
+        }
+
+        MemoryResource* getUpstreamMemoryResource() const {
+            return upstream;
+        }
+
+    private:
+        struct Block {
+            Block* next;
+        };
+
+        struct Chunk {
+            Chunk* next;
+            std::size_t size;
+        };
+
+        struct FreeList {
+            Block* head = nullptr;
+            std::size_t count = 0ul;
+
+            void push(Block* block) {
+                block->next = head;
+                head = block;
+                ++count;
+            }
+
+            Block* pop() {
+                Block* block = head;
+                head = block->next;
+                --count;
+                return block;
+            }
+
+            // Moves up to the given number of blocks from the front of this list to the front of the destination list
+            void transferTo(FreeList& destination, std::size_t maxCount) {
+                if (head == nullptr) {
+                    return;
+                }
+                Block* first = head;
+                Block* last = head;
+                std::size_t transferred = 1ul;
+                while ((transferred < maxCount) && (last->next != nullptr)) {
+                    last = last->next;
+                    ++transferred;
+                }
+                head = last->next;
+                count -= transferred;
+                last->next = destination.head;
+                destination.head = first;
+                destination.count += transferred;
+            }
+        };
+
+        struct Cache {
+            std::mutex mutex;
+            std::array<FreeList, maxSizeClassCount> freeLists = {};
+            Chunk* chunks = nullptr;
+        };
+
+        // Blocks in excess of what a cache keeps around, available to all caches
+        struct SharedFreeLists {
+            std::mutex mutex;
+            std::array<FreeList, maxSizeClassCount> freeLists = {};
+        };
+
+    private:
+        static std::size_t getSizeClass(std::size_t size, std::size_t alignment) {
+            const std::size_t blockSize = roundUpToPowerOfTwo(std::max(std::max(size, alignment), minBlockSize));
+            return binaryLog(blockSize / minBlockSize);
+        }
+
+        Cache& getCache() {
+            return caches[currentThreadIndex() % caches.size()];
+        }
+
+        std::size_t getBlocksPerChunk(std::size_t sizeClass) const {
+            return std::max(chunkSize / (minBlockSize << sizeClass), 1ul);
+        }
+
+        // Called with the mutex of the cache that owns the given free list locked, which is always locked first
+        bool takeShared(FreeList& freeList, std::size_t sizeClass) {
+            std::lock_guard<std::mutex> lock{shared.mutex};
+            shared.freeLists[sizeClass].transferTo(freeList, getBlocksPerChunk(sizeClass));
+            return (freeList.head != nullptr);
+        }
+
+        void giveShared(FreeList& freeList, std::size_t sizeClass) {
+            std::lock_guard<std::mutex> lock{shared.mutex};
+            freeList.transferTo(shared.freeLists[sizeClass], getBlocksPerChunk(sizeClass));
+        }
+
+        bool allocateChunk(Cache& cache, std::size_t sizeClass) {
+            const std::size_t blockSize = minBlockSize << sizeClass;
+            const std::size_t blockCount = getBlocksPerChunk(sizeClass);
+            // Blocks are aligned to their size, so there's room left for aligning the first block after the chunk header
+            const std::size_t size = sizeof(Chunk) + (blockCount + 1ul) * blockSize;
+            char* memory = static_cast<char*>(upstream->allocate(size, alignof(std::max_align_t)));
+            if (memory == nullptr) {
+                return false;
+            }
+
+            Chunk* chunk = reinterpret_cast<Chunk*>(memory);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            chunk->next = cache.chunks;
+            chunk->size = size;
+            cache.chunks = chunk;
+
+            // Blocks are linked in the order of their addresses, so consecutive allocations are adjacent in memory
+            char* first = alignPointer(memory + sizeof(Chunk), blockSize);
+            FreeList& freeList = cache.freeLists[sizeClass];
+            for (std::size_t i = blockCount; i > 0ul; --i) {
+                freeList.push(reinterpret_cast<Block*>(first + (i - 1ul) * blockSize));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            }
+            return true;
+        }
+
+    private:
+        Vector<Cache> caches;
+        SharedFreeLists shared;
+        std::size_t maxBlockSize;
+        std::size_t chunkSize;
+        MemoryResource* upstream;
+
+};
+
+PoolMemoryResource::PoolMemoryResource(std::size_t maxBlockSize, std::size_t chunkSize, MemoryResource* upstream) :
+    pImpl{makeScoped<Impl, FactoryCreate, FactoryDestroy>(maxBlockSize, chunkSize, upstream)} {
+}
+
+PoolMemoryResource::PoolMemoryResource(MemoryResource* upstream) :
+    PoolMemoryResource{4096ul, 65536ul, upstream} {
+}
+
+PoolMemoryResource::~PoolMemoryResource() = default;
+PoolMemoryResource::PoolMemoryResource(PoolMemoryResource&&) = default;
+PoolMemoryResource& PoolMemoryResource::operator=(PoolMemoryResource&&) = default;
+
+void* PoolMemoryResource::allocate(std::size_t size, std::size_t alignment) {
+    return pImpl->allocate(size, alignment);
+}
+
+void PoolMemoryResource::deallocate(void* ptr, std::size_t size, std::size_t alignment) {
+    pImpl->deallocate(ptr, size, alignment);
+}
+
+MemoryResource* PoolMemoryResource::getUpstreamMemoryResource() const {
+    return pImpl->getUpstreamMemoryResource();
+}
+
+}  // namespace pma
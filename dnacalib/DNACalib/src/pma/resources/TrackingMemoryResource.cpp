@@ -0,0 +1,240 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "pma/resources/TrackingMemoryResource.h"
+
+#include "pma/ScopedPtr.h"
+#include "pma/TypeDefs.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <mutex>
+#include <string>
+
+namespace pma {
+
+namespace {
+
+// Tag path of the calling thread, shared by all tracking resources
+String<char>& currentTagPath() {
+    thread_local static String<char> path;
+    return path;
+}
+
+// Number of existing tracking resources, as tags are recorded only while there are any
+std::atomic<std::size_t>& trackingResourceCount() {
+    static std::atomic<std::size_t> count{0ul};
+    return count;
+}
+
+}  // namespace
+
+ScopedAllocationTag::ScopedAllocationTag(const char* tag) :
+    previousLength{},
+    recorded{trackingResourceCount().load(std::memory_order_relaxed) != 0ul} {
+    if (!recorded) {
+        return;
+    }
+    auto& path = currentTagPath();
+    previousLength = path.size();
+    if (!path.empty()) {
+        path.push_back('/');
+    }
+    path.append(tag);
+}
+
+ScopedAllocationTag::ScopedAllocationTag(const char* tag, std::size_t index) : ScopedAllocationTag{tag} {
+    if (!recorded) {
+        return;
+    }
+    auto& path = currentTagPath();
+    path.push_back('[');
+    path.append(std::to_string(index).c_str());
+    path.push_back(']');
+}
+
+ScopedAllocationTag::~ScopedAllocationTag() {
+    if (recorded) {
+        currentTagPath().resize(previousLength);
+    }
+}
+
+class TrackingMemoryResource::Impl {
+    public:
+        static Impl* create(MemoryResource* upstream_) {
+            PolyAllocator<Impl> alloc{upstream_};
+            return alloc.newObject(upstream_);
+        }
+
+        static void destroy(Impl* instance) {
+            PolyAllocator<Impl> alloc{instance->upstream};
+            alloc.deleteObject(instance);
+        }
+
+        explicit Impl(MemoryResource* upstream_) :
+            upstream{upstream_},
+            root{String<char>{upstream_}, nullptr, {}},
+            records{upstream_},
+            tags{upstream_},
+            recordsByPath{upstream_},
+            owners{upstream_},
+            mutex{} {
+
+            assert(upstream != nullptr);
+            ++trackingResourceCount();
+        }
+
+        ~Impl() {
+            --trackingResourceCount();
+        }
+
+        Impl(const Impl&) = delete;
+        Impl& operator=(const Impl&) = delete;
+
+        Impl(Impl&&) = delete;
+        Impl& operator=(Impl&&) = delete;
+
+        void* allocate(std::size_t size, std::size_t alignment) {
+            void* ptr = upstream->allocate(size, alignment);
+            if (ptr == nullptr) {
+                return nullptr;
+            }
+
+            std::lock_guard<std::mutex> lock{mutex};
+            Record* owner = getRecord(currentTagPath());
+            owners[ptr] = owner;
+            for (Record* record = owner; record != nullptr; record = record->parent) {
+                auto& statistics = record->statistics;
+                statistics.usedBytes += size;
+                statistics.peakUsedBytes = std::max(statistics.peakUsedBytes, statistics.usedBytes);
+                statistics.totalAllocatedBytes += size;
+                ++statistics.allocationCount;
+            }
+            return ptr;
+        }
+
+        void deallocate(void* ptr, std::size_t size, std::size_t alignment) {
+            {
+                // Accounted before the memory is actually freed, as it may be allocated again right after
+                std::lock_guard<std::mutex> lock{mutex};
+                auto it = owners.find(ptr);
+                if (it != owners.end()) {
+                    for (Record* record = it->second; record != nullptr; record = record->parent) {
+                        record->statistics.usedBytes -= size;
+                        ++record->statistics.deallocationCount;
+                    }
+                    owners.erase(it);
+                }
+            }
+            upstream->deallocate(ptr, size, alignment);
+        }
+
+        MemoryResource* getUpstreamMemoryResource() const {
+            return upstream;
+        }
+
+        Statistics getStatistics(const char* tag) const {
+            std::lock_guard<std::mutex> lock{mutex};
+            if ((tag == nullptr) || (*tag == '\0')) {
+                return root.statistics;
+            }
+            auto it = recordsByPath.find(String<char>{tag, upstream});
+            return (it == recordsByPath.end() ? Statistics{} : it->second->statistics);
+        }
+
+        std::size_t getTagCount() const {
+            std::lock_guard<std::mutex> lock{mutex};
+            return tags.size();
+        }
+
+        const char* getTag(std::size_t index) const {
+            std::lock_guard<std::mutex> lock{mutex};
+            return (index < tags.size() ? tags[index]->path.c_str() : nullptr);
+        }
+
+        Statistics getTagStatistics(std::size_t index) const {
+            std::lock_guard<std::mutex> lock{mutex};
+            return (index < tags.size() ? tags[index]->statistics : Statistics{});
+        }
+
+    private:
+        struct Record {
+            String<char> path;
+            Record* parent;
+            Statistics statistics;
+        };
+
+    private:
+        // Finds the record of the given tag path, creating it (and the records of its enclosing tags) if needed
+        Record* getRecord(const String<char>& path) {
+            if (path.empty()) {
+                return &root;
+            }
+            auto it = recordsByPath.find(path);
+            if (it != recordsByPath.end()) {
+                return it->second;
+            }
+
+            const auto separator = path.rfind('/');
+            Record* parent = (separator == String<char>::npos ? &root : getRecord(path.substr(0ul, separator)));
+            records.push_back({String<char>{path, upstream}, parent, {}});
+            Record* record = &records.back();
+            tags.push_back(record);
+            recordsByPath.emplace(record->path, record);
+            return record;
+        }
+
+    private:
+        MemoryResource* upstream;
+        Record root;
+        // Records are held in a list, so tag paths returned by getTag remain valid as new records are added
+        List<Record> records;
+        Vector<Record*> tags;
+        Map<String<char>, Record*> recordsByPath;
+        UnorderedMap<void*, Record*> owners;
+        mutable std::mutex mutex;
+
+};
+
+TrackingMemoryResource::TrackingMemoryResource(MemoryResource* upstream) :
+    pImpl{makeScoped<Impl, FactoryCreate, FactoryDestroy>(upstream)} {
+}
+
+TrackingMemoryResource::~TrackingMemoryResource() = default;
+TrackingMemoryResource::TrackingMemoryResource(TrackingMemoryResource&&) = default;
+TrackingMemoryResource& TrackingMemoryResource::operator=(TrackingMemoryResource&&) = default;
+
+void* TrackingMemoryResource::allocate(std::size_t size, std::size_t alignment) {
+    return pImpl->allocate(size, alignment);
+}
+
+void TrackingMemoryResource::deallocate(void* ptr, std::size_t size, std::size_t alignment) {
+    pImpl->deallocate(ptr, size, alignment);
+}
+
+MemoryResource* TrackingMemoryResource::getUpstreamMemoryResource() const {
+    return pImpl->getUpstreamMemoryResource();
+}
+
+TrackingMemoryResource::Statistics TrackingMemoryResource::getStatistics() const {
+    return pImpl->getStatistics(nullptr);
+}
+
+TrackingMemoryResource::Statistics TrackingMemoryResource::getStatistics(const char* tag) const {
+    return pImpl->getStatistics(tag);
+}
+
+std::size_t TrackingMemoryResource::getTagCount() const {
+    return pImpl->getTagCount();
+}
+
+const char* TrackingMemoryResource::getTag(std::size_t index) const {
+    return pImpl->getTag(index);
+}
+
+TrackingMemoryResource::Statistics TrackingMemoryResource::getTagStatistics(std::size_t index) const {
+    return pImpl->getTagStatistics(index);
+}
+
+}  // namespace pma
@@ -6,6 +6,8 @@
     #pragma warning(push)
     #pragma warning(disable : 4365 4987)
 #endif
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <type_traits>
 #include <utility>
@@ -118,6 +120,28 @@ struct has_wide_elements {
     static constexpr bool value = (sizeof(typename TContainer::value_type) > 1ul);
 };
 
+template<class TContainer>
+static auto test_storage_alignment(std::int32_t)->decltype(TContainer::alignment());
+
+template<class>
+static auto test_storage_alignment(std::uint32_t)->void;
+
+// Alignment of the storage that containers declaring it (e.g. DynArray) allocate, at least that of their elements
+template<typename TContainer, typename = void>
+struct storage_alignment {
+    static std::size_t value() {
+        return alignof(typename TContainer::value_type);
+    }
+};
+
+template<typename TContainer>
+struct storage_alignment<TContainer,
+                         typename std::enable_if<!std::is_void<decltype(test_storage_alignment<TContainer>(0))>::value>::type> {
+    static std::size_t value() {
+        return std::max(static_cast<std::size_t>(TContainer::alignment()), alignof(typename TContainer::value_type));
+    }
+};
+
 template<typename T>
 struct is_pair : public std::false_type {};
 
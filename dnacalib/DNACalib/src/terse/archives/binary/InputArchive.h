@@ -17,6 +17,7 @@
     #pragma warning(push)
     #pragma warning(disable : 4365 4987)
 #endif
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstddef>
@@ -49,13 +50,44 @@ class ExtendableBinaryInputArchive : public Archive<TExtender> {
         using BaseArchive = Archive<TExtender>;
 
     public:
-        ExtendableBinaryInputArchive(TExtender* extender, TStream* stream_) : BaseArchive{extender}, stream{stream_} {
+        ExtendableBinaryInputArchive(TExtender* extender, TStream* stream_) :
+            BaseArchive{extender},
+            stream{stream_},
+            order{EByteOrder},
+            alignElements{false},
+            alignStorage{false} {
         }
 
         bool isOk() {
             return true;
         }
 
+        Endianness byteOrder() const {
+            return order;
+        }
+
+        void setByteOrder(Endianness byteOrder_) {
+            order = byteOrder_;
+        }
+
+        bool elementAlignment() const {
+            return alignElements;
+        }
+
+        void setElementAlignment(bool enabled) {
+            alignElements = enabled;
+        }
+
+        bool storageAlignment() const {
+            return alignStorage;
+        }
+
+        // With both element and storage alignment enabled, elements are aligned as the storage of the containers holding
+        // them (e.g. to a cache line for aligned arrays), instead of just to their own size
+        void setStorageAlignment(bool enabled) {
+            alignStorage = enabled;
+        }
+
         void sync() {
         }
 
@@ -142,7 +174,7 @@ class ExtendableBinaryInputArchive : public Archive<TExtender> {
                                 void>::type process(T& dest) {
             // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
             stream->read(reinterpret_cast<char*>(&dest), sizeof(T));
-            SwapFrom<EByteOrder>::swap(dest);
+            swap(dest);
         }
 
         template<typename T, std::size_t N>
@@ -220,16 +252,21 @@ class ExtendableBinaryInputArchive : public Archive<TExtender> {
             using ValueType = typename TContainer::value_type;
             if (size != 0ul) {
                 resize(dest, size);
+                processPadding<TContainer>();
                 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
                 stream->read(reinterpret_cast<char*>(&dest[0]), size * sizeof(ValueType));
+                if (order == nativeEndianness()) {
+                    return;
+                }
+
                 const std::size_t blockWidth = 16ul / sizeof(ValueType);
                 const std::size_t alignedSize = size - (size % blockWidth);
                 for (std::size_t i = 0ul; i < alignedSize; i += blockWidth) {
-                    SwapFrom<EByteOrder>::swap(&dest[i]);
+                    swap(&dest[i]);
                 }
 
                 for (std::size_t i = alignedSize; i < size; ++i) {
-                    SwapFrom<EByteOrder>::swap(dest[i]);
+                    swap(dest[i]);
                 }
             }
         }
@@ -245,7 +282,49 @@ class ExtendableBinaryInputArchive : public Archive<TExtender> {
             }
         }
 
+        template<class TContainer>
+        void processPadding() {
+            // With element alignment enabled, the elements of batchable containers are preceded by padding
+            // which aligns them to their own size (or the alignment of their storage) within the stream
+            const auto alignment = paddingAlignment<TContainer>();
+            if (alignElements && (alignment > 1ul)) {
+                const auto position = stream->tell();
+                const auto remainder = position % alignment;
+                if (remainder != 0ul) {
+                    stream->seek(position + (alignment - remainder));
+                }
+            }
+        }
+
+        template<class TContainer>
+        std::size_t paddingAlignment() const {
+            // Containers of single byte elements are never padded
+            const std::size_t elementSize = sizeof(typename TContainer::value_type);
+            if (!alignStorage || (elementSize == 1ul)) {
+                return elementSize;
+            }
+            return std::max(elementSize, traits::storage_alignment<TContainer>::value());
+        }
+
     private:
+        template<typename T>
+        void swap(T& value) {
+            if (order == Endianness::Little) {
+                SwapFrom<Endianness::Little>::swap(value);
+            } else {
+                SwapFrom<Endianness::Big>::swap(value);
+            }
+        }
+
+        template<typename T>
+        void swap(T* values) {
+            if (order == Endianness::Little) {
+                SwapFrom<Endianness::Little>::swap(values);
+            } else {
+                SwapFrom<Endianness::Big>::swap(values);
+            }
+        }
+
         template<class TContainer>
         void resize(TContainer& dest, std::size_t size) {
             dest.resize(size);
@@ -258,6 +337,9 @@ class ExtendableBinaryInputArchive : public Archive<TExtender> {
 
     private:
         TStream* stream;
+        Endianness order;
+        bool alignElements;
+        bool alignStorage;
 };
 
 template<class TStream, typename TSize = std::uint32_t, typename TOffset = TSize, Endianness EByteOrder = Endianness::Network>
@@ -16,6 +16,7 @@
     #pragma warning(push)
     #pragma warning(disable : 4365 4987)
 #endif
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstddef>
@@ -49,13 +50,44 @@ class ExtendableBinaryOutputArchive : public Archive<TExtender> {
         }
 
     public:
-        ExtendableBinaryOutputArchive(TExtender* extender, TStream* stream_) : BaseArchive{extender}, stream{stream_} {
+        ExtendableBinaryOutputArchive(TExtender* extender, TStream* stream_) :
+            BaseArchive{extender},
+            stream{stream_},
+            order{EByteOrder},
+            alignElements{false},
+            alignStorage{false} {
         }
 
         bool isOk() {
             return true;
         }
 
+        Endianness byteOrder() const {
+            return order;
+        }
+
+        void setByteOrder(Endianness byteOrder_) {
+            order = byteOrder_;
+        }
+
+        bool elementAlignment() const {
+            return alignElements;
+        }
+
+        void setElementAlignment(bool enabled) {
+            alignElements = enabled;
+        }
+
+        bool storageAlignment() const {
+            return alignStorage;
+        }
+
+        // With both element and storage alignment enabled, elements are aligned as the storage of the containers holding
+        // them (e.g. to a cache line for aligned arrays), instead of just to their own size
+        void setStorageAlignment(bool enabled) {
+            alignStorage = enabled;
+        }
+
         void sync() {
         }
 
@@ -182,7 +214,7 @@ class ExtendableBinaryOutputArchive : public Archive<TExtender> {
                                 void>::type process(const T& source) {
             T swapped;
             std::memcpy(&swapped, &source, sizeof(T));
-            SwapTo<EByteOrder>::swap(swapped);
+            swap(swapped);
             // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
             stream->write(reinterpret_cast<char*>(&swapped), sizeof(T));
         }
@@ -238,6 +270,20 @@ class ExtendableBinaryOutputArchive : public Archive<TExtender> {
         template<class TContainer>
         typename std::enable_if<traits::is_batchable<TContainer>::value && traits::has_wide_elements<TContainer>::value>::type
         processElements(const TContainer& source) {
+            using ValueType = typename TContainer::value_type;
+            const auto size = source.size();
+            if (size == 0ul) {
+                return;
+            }
+
+            processPadding<TContainer>();
+            if (order == nativeEndianness()) {
+                // Elements are already in the requested byte order, so they can be written in a single batch
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                stream->write(reinterpret_cast<const char*>(&source[0]), size * sizeof(ValueType));
+                return;
+            }
+
             for (const auto& element : source) {
                 BaseArchive::dispatch(element);
             }
@@ -254,8 +300,49 @@ class ExtendableBinaryOutputArchive : public Archive<TExtender> {
             }
         }
 
+        template<class TContainer>
+        void processPadding() {
+            // With element alignment enabled, the elements of batchable containers are preceded by padding
+            // which aligns them to their own size (or the alignment of their storage) within the stream
+            const auto alignment = paddingAlignment<TContainer>();
+            if (alignElements && (alignment > 1ul)) {
+                static constexpr std::size_t maxPaddingChunk = 64ul;
+                static constexpr char zeros[maxPaddingChunk] = {};
+                const auto remainder = stream->tell() % alignment;
+                auto padding = (remainder == 0ul ? 0ul : alignment - remainder);
+                while (padding != 0ul) {
+                    const auto chunk = std::min(padding, maxPaddingChunk);
+                    stream->write(static_cast<const char*>(zeros), chunk);
+                    padding -= chunk;
+                }
+            }
+        }
+
+        template<class TContainer>
+        std::size_t paddingAlignment() const {
+            // Containers of single byte elements are never padded
+            const std::size_t elementSize = sizeof(typename TContainer::value_type);
+            if (!alignStorage || (elementSize == 1ul)) {
+                return elementSize;
+            }
+            return std::max(elementSize, traits::storage_alignment<TContainer>::value());
+        }
+
+    private:
+        template<typename T>
+        void swap(T& value) {
+            if (order == Endianness::Little) {
+                SwapTo<Endianness::Little>::swap(value);
+            } else {
+                SwapTo<Endianness::Big>::swap(value);
+            }
+        }
+
     private:
         TStream* stream;
+        Endianness order;
+        bool alignElements;
+        bool alignStorage;
 };
 
 template<class TStream, typename TSize = std::uint32_t, typename TOffset = TSize, Endianness EByteOrder = Endianness::Network>
@@ -9,9 +9,10 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
-#include <functional>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #ifdef _MSC_VER
@@ -22,6 +23,9 @@ namespace terse {
 
 /**
  * @brief Resizable array-like abstraction for trivial-types only.
+ * @note
+ *  Arrays small enough to fit into the space of two pointers are stored inline, without any allocation,
+ *  unless the allocator requests an extended alignment, which inline storage could not satisfy.
  */
 template<typename T, class TAllocator>
 class DynArray {
@@ -32,22 +36,33 @@ class DynArray {
         using allocator_type = TAllocator;
 
     private:
-        using pointer_type = std::unique_ptr<value_type, std::function<void (value_type*)> >;
+        static constexpr std::size_t inlineSize = 2ul * sizeof(value_type*);
+        static constexpr std::size_t inlineCapacity = inlineSize / sizeof(value_type);
+        // Capacity value denoting that the elements are stored inline, while a capacity of zero denotes storage
+        // that is not owned by the array (either none at all, or borrowed)
+        static constexpr std::size_t inlineMarker = std::numeric_limits<std::size_t>::max();
+
+        union Storage {
+            value_type* ptr;
+            alignas(value_type) unsigned char bytes[inlineSize];
+        };
 
     public:
         explicit DynArray(const allocator_type& allocator) :
             alloc{allocator},
             sz{},
-            ptr{nullptr} {
+            cap{},
+            storage{} {
         }
 
         DynArray() : DynArray{allocator_type{}} {
         }
 
         DynArray(std::size_t size, const allocator_type& allocator = allocator_type{}) :
-            alloc{allocator},
-            sz{size},
-            ptr{create(sz, alloc)} {
+            DynArray{allocator} {
+
+            reserve(size);
+            sz = size;
         }
 
         DynArray(std::size_t size, const value_type& value, const allocator_type& allocator = allocator_type{}) :
@@ -77,7 +92,9 @@ class DynArray {
             #endif
         }
 
-        ~DynArray() = default;
+        ~DynArray() {
+            release();
+        }
 
         DynArray(const DynArray& rhs) : DynArray{rhs.size(), rhs.get_allocator()} {
             if ((data() != nullptr) && (rhs.data() != nullptr)) {
@@ -87,26 +104,21 @@ class DynArray {
 
         DynArray& operator=(const DynArray& rhs) {
             DynArray tmp{rhs};
-            std::swap(alloc, tmp.alloc);
-            std::swap(ptr, tmp.ptr);
-            std::swap(sz, tmp.sz);
+            swap(tmp);
             return *this;
         }
 
         DynArray(DynArray&& rhs) noexcept :
             alloc{},
             sz{},
-            ptr{} {
+            cap{},
+            storage{} {
 
-            std::swap(alloc, rhs.alloc);
-            std::swap(ptr, rhs.ptr);
-            std::swap(sz, rhs.sz);
+            swap(rhs);
         }
 
         DynArray& operator=(DynArray&& rhs) noexcept {
-            std::swap(alloc, rhs.alloc);
-            std::swap(ptr, rhs.ptr);
-            std::swap(sz, rhs.sz);
+            swap(rhs);
             return *this;
         }
 
@@ -115,16 +127,18 @@ class DynArray {
         }
 
         void clear() {
-            ptr.reset();
+            release();
             sz = 0ul;
         }
 
         value_type* data() {
-            return ptr.get();
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            return (cap == inlineMarker ? reinterpret_cast<value_type*>(storage.bytes) : storage.ptr);
         }
 
         const value_type* data() const {
-            return ptr.get();
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            return (cap == inlineMarker ? reinterpret_cast<const value_type*>(storage.bytes) : storage.ptr);
         }
 
         std::size_t size() const {
@@ -171,14 +185,7 @@ class DynArray {
 
         void resize(std::size_t size, const value_type& value) {
             if (size > sz) {
-                pointer_type old{ptr.release(), [this](value_type* p) {
-                                     alloc.deallocate(p, sz);
-                                 }};
-                ptr = create(size, alloc);
-                assert(ptr != nullptr);
-                if (old != nullptr) {
-                    std::memcpy(ptr.get(), old.get(), sz * sizeof(value_type));
-                }
+                reserve(size);
                 std::fill_n(begin() + sz, size - sz, value);
             }
             sz = size;
@@ -188,20 +195,49 @@ class DynArray {
             resize(size, value_type{});
         }
 
+        /**
+         * @brief Resize without initializing new elements, in order for all of them to be written to.
+         * @note
+         *  Borrowed storage is never written to, so the kept elements are copied into owned storage instead.
+         */
         void resize_uninitialized(std::size_t size) {
-            if (size > sz) {
-                pointer_type old{ptr.release(), [this](value_type* p) {
-                                     alloc.deallocate(p, sz);
-                                 }};
-                ptr = create(size, alloc);
-                assert(ptr != nullptr);
-                if (old != nullptr) {
-                    std::memcpy(ptr.get(), old.get(), sz * sizeof(value_type));
-                }
+            if (cap == 0ul) {
+                sz = std::min(sz, size);
+                reserve(size);
+            } else if (size > sz) {
+                reserve(size);
             }
             sz = size;
         }
 
+        /**
+         * @brief Reference externally owned storage instead of allocating it.
+         * @note
+         *  Borrowed storage is never deallocated by the array, so it must outlive it (and all moved-to arrays).
+         *  It is also treated as read-only (e.g. it may be a read-only memory mapping), so it must not be modified
+         *  through the array. Copies of the array, growing resizes and uninitialized resizes will allocate their own
+         *  storage, so arrays are meant to be copied (or made to own their elements) before modifying them in place.
+         */
+        void borrow(const value_type* source, std::size_t size) {
+            release();
+            storage.ptr = const_cast<value_type*>(source);
+            sz = size;
+        }
+
+        /**
+         * @brief Whether the elements are held in borrowed storage.
+         */
+        bool borrowed() const {
+            return (cap == 0ul) && (storage.ptr != nullptr);
+        }
+
+        /**
+         * @brief Alignment of the storage allocated by the array, which borrowed storage is also expected to satisfy.
+         */
+        static std::size_t alignment() {
+            return static_cast<std::size_t>(alignmentOf<allocator_type>(0));
+        }
+
         template<typename TIterator>
         void assign(TIterator start, TIterator end) {
             resize_uninitialized(static_cast<std::size_t>(std::distance(start, end)));
@@ -215,16 +251,73 @@ class DynArray {
         }
 
     private:
-        static pointer_type create(std::size_t size, allocator_type alloc) {
-            return pointer_type{alloc.allocate(size), [alloc, size](value_type* p) mutable {
-                                    alloc.deallocate(p, size);
-                                }};
+        std::size_t capacity() const {
+            if (cap == inlineMarker) {
+                return inlineCapacity;
+            }
+            return cap;
+        }
+
+        // Ensures owned storage for at least the given number of elements, keeping the current elements, which
+        // might also be in borrowed storage
+        void reserve(std::size_t size) {
+            if ((size == 0ul) || (size <= capacity())) {
+                return;
+            }
+            if ((size <= inlineCapacity) && (cap == 0ul) && fitsInline()) {
+                // Only storage that is not owned may be replaced by inline storage, as owned storage is already larger
+                const value_type* source = storage.ptr;
+                if (source != nullptr) {
+                    std::memcpy(storage.bytes, source, sz * sizeof(value_type));
+                }
+                cap = inlineMarker;
+                return;
+            }
+            value_type* ptr = alloc.allocate(size);
+            assert(ptr != nullptr);
+            if (sz != 0ul) {
+                std::memcpy(ptr, data(), sz * sizeof(value_type));
+            }
+            release();
+            storage.ptr = ptr;
+            cap = size;
+        }
+
+        void release() {
+            if ((cap != 0ul) && (cap != inlineMarker)) {
+                alloc.deallocate(storage.ptr, cap);
+            }
+            storage.ptr = nullptr;
+            cap = 0ul;
+        }
+
+        void swap(DynArray& rhs) noexcept {
+            std::swap(alloc, rhs.alloc);
+            std::swap(sz, rhs.sz);
+            std::swap(cap, rhs.cap);
+            std::swap(storage, rhs.storage);
+        }
+
+        static bool fitsInline() {
+            return (alignmentOf<allocator_type>(0) <= alignof(std::max_align_t));
+        }
+
+        // Alignment requested by allocators that specify it, otherwise the natural alignment of the elements
+        template<class TAlloc>
+        static auto alignmentOf(std::int32_t  /*unused*/)->decltype(TAlloc::getAlignment()) {
+            return TAlloc::getAlignment();
+        }
+
+        template<class TAlloc>
+        static std::size_t alignmentOf(...) {
+            return alignof(value_type);
         }
 
     private:
         allocator_type alloc;
         std::size_t sz;
-        pointer_type ptr;
+        std::size_t cap;
+        Storage storage;
 
 };
 
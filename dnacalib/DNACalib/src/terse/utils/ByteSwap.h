@@ -56,6 +56,14 @@ enum class Endianness {
     Network = Big
 };
 
+constexpr Endianness nativeEndianness() {
+    #if defined(TARGET_LITTLE_ENDIAN)
+        return Endianness::Little;
+    #else
+        return Endianness::Big;
+    #endif  // TARGET_LITTLE_ENDIAN
+}
+
 template<Endianness EByteOrder>
 struct ByteSwapper;
 
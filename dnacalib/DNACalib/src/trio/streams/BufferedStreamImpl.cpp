@@ -0,0 +1,268 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "trio/streams/BufferedStreamImpl.h"
+
+#include <pma/PolyAllocator.h>
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace trio {
+
+namespace {
+
+constexpr std::size_t defaultBufferSize = 64ul * 1024ul;
+
+}  // namespace
+
+BufferedStream::~BufferedStream() = default;
+
+BufferedStream* BufferedStream::create(BoundedIOStream* stream, MemoryResource* memRes) {
+    return create(stream, defaultBufferSize, memRes);
+}
+
+BufferedStream* BufferedStream::create(BoundedIOStream* stream, std::size_t bufferSize, MemoryResource* memRes) {
+    pma::PolyAllocator<BufferedStreamImpl> alloc{memRes};
+    return alloc.newObject(stream, bufferSize, memRes);
+}
+
+void BufferedStream::destroy(BufferedStream* instance) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    auto stream = static_cast<BufferedStreamImpl*>(instance);
+    pma::PolyAllocator<BufferedStreamImpl> alloc{stream->getMemoryResource()};
+    alloc.deleteObject(stream);
+}
+
+BufferedStreamImpl::BufferedStreamImpl(BoundedIOStream* stream_, std::size_t bufferSize, MemoryResource* memRes_) :
+    stream{stream_},
+    buffer{bufferSize, static_cast<char>(0), memRes_},
+    bufferPosition{},
+    cursor{},
+    length{},
+    mode{Mode::Empty},
+    streamPosition{},
+    memRes{memRes_} {
+}
+
+void BufferedStreamImpl::open() {
+    stream->open();
+    streamPosition = stream->tell();
+    bufferPosition = streamPosition;
+    cursor = 0ul;
+    length = 0ul;
+    mode = Mode::Empty;
+}
+
+void BufferedStreamImpl::close() {
+    flush();
+    stream->close();
+    streamPosition = 0ul;
+    bufferPosition = 0ul;
+}
+
+std::uint64_t BufferedStreamImpl::tell() {
+    return bufferPosition + cursor;
+}
+
+void BufferedStreamImpl::seek(std::uint64_t position) {
+    // Seeking within the buffered region (e.g. when offsets are patched shortly after they were written) keeps the buffer
+    if ((mode != Mode::Empty) && (position >= bufferPosition) && (position - bufferPosition <= length)) {
+        #if !defined(__clang__) && defined(__GNUC__)
+            #pragma GCC diagnostic push
+            #pragma GCC diagnostic ignored "-Wuseless-cast"
+        #endif
+        cursor = static_cast<std::size_t>(position - bufferPosition);
+        #if !defined(__clang__) && defined(__GNUC__)
+            #pragma GCC diagnostic pop
+        #endif
+        return;
+    }
+    flush();
+    // The underlying stream is seeked immediately, so invalid positions are reported as they would be without buffering
+    seekStream(position);
+    bufferPosition = position;
+}
+
+std::uint64_t BufferedStreamImpl::size() {
+    const std::uint64_t streamSize = stream->size();
+    if (mode == Mode::Writing) {
+        return std::max(streamSize, bufferPosition + length);
+    }
+    return streamSize;
+}
+
+std::size_t BufferedStreamImpl::read(char* destination, std::size_t size) {
+    if (destination == nullptr) {
+        status->set(ReadError);
+        return 0ul;
+    }
+    if (mode == Mode::Writing) {
+        flush();
+    }
+    const std::size_t bytesBuffered = readBuffered(destination, size);
+    if (bytesBuffered == size) {
+        return bytesBuffered;
+    }
+    const std::size_t remaining = size - bytesBuffered;
+    if (remaining >= buffer.size()) {
+        discard();
+        seekStream(bufferPosition);
+        const std::size_t bytesRead = stream->read(destination + bytesBuffered, remaining);
+        streamPosition += bytesRead;
+        bufferPosition += bytesRead;
+        return bytesBuffered + bytesRead;
+    }
+    fill();
+    return bytesBuffered + readBuffered(destination + bytesBuffered, remaining);
+}
+
+std::size_t BufferedStreamImpl::read(Writable* destination, std::size_t size) {
+    if (destination == nullptr) {
+        status->set(ReadError);
+        return 0ul;
+    }
+    if (mode == Mode::Writing) {
+        flush();
+    }
+    const std::size_t bytesBuffered = readBuffered(destination, size);
+    if (bytesBuffered == size) {
+        return bytesBuffered;
+    }
+    const std::size_t remaining = size - bytesBuffered;
+    if (remaining >= buffer.size()) {
+        discard();
+        seekStream(bufferPosition);
+        const std::size_t bytesRead = stream->read(destination, remaining);
+        streamPosition += bytesRead;
+        bufferPosition += bytesRead;
+        return bytesBuffered + bytesRead;
+    }
+    fill();
+    return bytesBuffered + readBuffered(destination, remaining);
+}
+
+std::size_t BufferedStreamImpl::write(const char* source, std::size_t size) {
+    if (source == nullptr) {
+        status->set(WriteError);
+        return 0ul;
+    }
+    if (mode == Mode::Reading) {
+        discard();
+    }
+    if (cursor + size > buffer.size()) {
+        flush();
+        if (size >= buffer.size()) {
+            seekStream(bufferPosition);
+            const std::size_t bytesWritten = stream->write(source, size);
+            streamPosition += bytesWritten;
+            bufferPosition += bytesWritten;
+            return bytesWritten;
+        }
+    }
+    std::memcpy(buffer.data() + cursor, source, size);
+    cursor += size;
+    length = std::max(length, cursor);
+    mode = Mode::Writing;
+    return size;
+}
+
+std::size_t BufferedStreamImpl::write(Readable* source, std::size_t size) {
+    if (source == nullptr) {
+        status->set(WriteError);
+        return 0ul;
+    }
+    if (mode == Mode::Reading) {
+        discard();
+    }
+    if (cursor + size > buffer.size()) {
+        flush();
+        if (size >= buffer.size()) {
+            seekStream(bufferPosition);
+            const std::size_t bytesWritten = stream->write(source, size);
+            streamPosition += bytesWritten;
+            bufferPosition += bytesWritten;
+            return bytesWritten;
+        }
+    }
+    const std::size_t bytesWritten = source->read(buffer.data() + cursor, size);
+    cursor += bytesWritten;
+    length = std::max(length, cursor);
+    mode = Mode::Writing;
+    return bytesWritten;
+}
+
+void BufferedStreamImpl::flush() {
+    if ((mode == Mode::Writing) && (length != 0ul)) {
+        seekStream(bufferPosition);
+        streamPosition += stream->write(buffer.data(), length);
+    }
+    discard();
+}
+
+MemoryResource* BufferedStreamImpl::getMemoryResource() {
+    return memRes;
+}
+
+std::size_t BufferedStreamImpl::readBuffered(char* destination, std::size_t size) {
+    if (mode != Mode::Reading) {
+        return 0ul;
+    }
+    const std::size_t bytesCopied = std::min(length - cursor, size);
+    std::memcpy(destination, buffer.data() + cursor, bytesCopied);
+    cursor += bytesCopied;
+    return bytesCopied;
+}
+
+std::size_t BufferedStreamImpl::readBuffered(Writable* destination, std::size_t size) {
+    if (mode != Mode::Reading) {
+        return 0ul;
+    }
+    const std::size_t bytesToCopy = std::min(length - cursor, size);
+    const std::size_t bytesCopied = (bytesToCopy > 0ul ? destination->write(buffer.data() + cursor, bytesToCopy) : 0ul);
+    cursor += bytesCopied;
+    return bytesCopied;
+}
+
+void BufferedStreamImpl::fill() {
+    discard();
+    seekStream(bufferPosition);
+    // Reading past the end is avoided, as some streams (e.g. FileStream) become unusable after attempting it
+    const std::uint64_t streamSize = stream->size();
+    const std::uint64_t available = (streamSize > bufferPosition ? streamSize - bufferPosition : 0ul);
+    #if !defined(__clang__) && defined(__GNUC__)
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wuseless-cast"
+    #endif
+    const std::size_t bytesToRead = static_cast<std::size_t>(std::min(available, static_cast<std::uint64_t>(buffer.size())));
+    #if !defined(__clang__) && defined(__GNUC__)
+        #pragma GCC diagnostic pop
+    #endif
+    length = (bytesToRead > 0ul ? stream->read(buffer.data(), bytesToRead) : 0ul);
+    streamPosition += length;
+    mode = Mode::Reading;
+}
+
+void BufferedStreamImpl::discard() {
+    bufferPosition += cursor;
+    cursor = 0ul;
+    length = 0ul;
+    mode = Mode::Empty;
+}
+
+void BufferedStreamImpl::seekStream(std::uint64_t position) {
+    if (position != streamPosition) {
+        stream->seek(position);
+        streamPosition = position;
+    }
+}
+
+}  // namespace trio
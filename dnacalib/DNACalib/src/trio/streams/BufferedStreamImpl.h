@@ -0,0 +1,70 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "trio/streams/BufferedStream.h"
+#include "trio/streams/StreamStatus.h"
+#include "trio/types/Aliases.h"
+
+#include <pma/TypeDefs.h>
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <cstddef>
+#include <cstdint>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace trio {
+
+class BufferedStreamImpl : public BufferedStream {
+    public:
+        BufferedStreamImpl(BoundedIOStream* stream_, std::size_t bufferSize, MemoryResource* memRes_);
+
+        void open() override;
+        void close() override;
+        std::uint64_t tell() override;
+        void seek(std::uint64_t position) override;
+        std::uint64_t size() override;
+        std::size_t read(char* destination, std::size_t size) override;
+        std::size_t read(Writable* destination, std::size_t size) override;
+        std::size_t write(const char* source, std::size_t size) override;
+        std::size_t write(Readable* source, std::size_t size) override;
+        void flush() override;
+
+        MemoryResource* getMemoryResource();
+
+    private:
+        enum class Mode {
+            Empty,
+            Reading,
+            Writing
+        };
+
+    private:
+        std::size_t readBuffered(char* destination, std::size_t size);
+        std::size_t readBuffered(Writable* destination, std::size_t size);
+        void fill();
+        void discard();
+        void seekStream(std::uint64_t position);
+
+    private:
+        StreamStatus status;
+        BoundedIOStream* stream;
+        Vector<char> buffer;
+        // Position in the underlying stream where the buffered region begins
+        std::uint64_t bufferPosition;
+        // Position within the buffered region, so the position of the stream itself is bufferPosition + cursor
+        std::size_t cursor;
+        // Number of bytes in the buffered region, either read from the underlying stream, or yet to be written into it
+        std::size_t length;
+        Mode mode;
+        // Position of the underlying stream, tracked to avoid seeking it needlessly
+        std::uint64_t streamPosition;
+        MemoryResource* memRes;
+};
+
+}  // namespace trio
@@ -0,0 +1,17 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "trio/streams/FileStream.h"
+
+namespace trio {
+
+// Common base of all FileStream implementations, through which instances can be destroyed without knowing
+// which implementation was chosen when they were created
+class FileStreamBase : public FileStream {
+    public:
+        virtual void release() = 0;
+
+};
+
+}  // namespace trio
@@ -2,6 +2,7 @@
 
 #include "trio/streams/FileStreamImpl.h"
 
+#include "trio/streams/FileStreamUnix.h"
 #include "trio/utils/NativeString.h"
 #include "trio/utils/ScopedEnumEx.h"
 
@@ -51,11 +52,24 @@ FileStream* FileStream::create(const char* path, AccessMode accessMode, OpenMode
     return alloc.newObject(path, accessMode, openMode, memRes);
 }
 
+FileStream* FileStream::create(const char* path,
+                               AccessMode accessMode,
+                               OpenMode openMode,
+                               std::size_t transferSize,
+                               MemoryResource* memRes) {
+    #ifdef TRIO_PREAD_AVAILABLE
+        pma::PolyAllocator<FileStreamUnix> alloc{memRes};
+        return alloc.newObject(path, accessMode, openMode, transferSize, memRes);
+    #else
+        static_cast<void>(transferSize);
+        return create(path, accessMode, openMode, memRes);
+    #endif  // TRIO_PREAD_AVAILABLE
+}
+
 void FileStream::destroy(FileStream* instance) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-    auto stream = static_cast<FileStreamImpl*>(instance);
-    pma::PolyAllocator<FileStreamImpl> alloc{stream->getMemoryResource()};
-    alloc.deleteObject(stream);
+    auto stream = static_cast<FileStreamBase*>(instance);
+    stream->release();
 }
 
 FileStreamImpl::FileStreamImpl(const char* path_, AccessMode accessMode_, OpenMode openMode_, MemoryResource* memRes_) :
@@ -201,6 +215,11 @@ std::uint64_t FileStreamImpl::size() {
     return fileSize;
 }
 
+void FileStreamImpl::release() {
+    pma::PolyAllocator<FileStreamImpl> alloc{memRes};
+    alloc.deleteObject(this);
+}
+
 MemoryResource* FileStreamImpl::getMemoryResource() {
     return memRes;
 }
@@ -2,7 +2,7 @@
 
 #pragma once
 
-#include "trio/streams/FileStream.h"
+#include "trio/streams/FileStreamBase.h"
 #include "trio/streams/StreamStatus.h"
 #include "trio/types/Aliases.h"
 #include "trio/utils/NativeString.h"
@@ -23,7 +23,7 @@
 
 namespace trio {
 
-class FileStreamImpl : public FileStream {
+class FileStreamImpl : public FileStreamBase {
     public:
         FileStreamImpl(const char* path_, AccessMode accessMode_, OpenMode openMode_, MemoryResource* memRes_);
 
@@ -36,6 +36,7 @@ class FileStreamImpl : public FileStream {
         std::size_t read(Writable* destination, std::size_t size) override;
         std::size_t write(const char* source, std::size_t size) override;
         std::size_t write(Readable* source, std::size_t size) override;
+        void release() override;
 
         MemoryResource* getMemoryResource();
 
@@ -0,0 +1,315 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+// *INDENT-OFF*
+#ifdef TRIO_PREAD_AVAILABLE
+
+#ifdef TRIO_LARGE_FILE_SUPPORT_AVAILABLE
+    #define _FILE_OFFSET_BITS 64
+#endif  // TRIO_LARGE_FILE_SUPPORT
+
+#include "trio/streams/FileStreamUnix.h"
+#include "trio/utils/NativeString.h"
+#include "trio/utils/ScopedEnumEx.h"
+
+#include <pma/PolyAllocator.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace trio {
+
+namespace {
+
+constexpr std::size_t defaultTransferSizeUnix = 4ul * 1024ul * 1024ul;
+
+inline std::uint64_t getFileSizeUnix(const NativeCharacter* path) {
+    struct stat st{};
+    if (::stat(path, &st) != 0) {
+        return 0ul;
+    }
+    return static_cast<std::uint64_t>(st.st_size);
+}
+
+inline std::size_t getTransferSizeUnix(std::size_t transferSize) {
+    return (transferSize == 0ul ? defaultTransferSizeUnix : transferSize);
+}
+
+}  // namespace
+
+FileStreamUnix::FileStreamUnix(const char* path_,
+                               AccessMode accessMode_,
+                               OpenMode openMode_,
+                               std::size_t transferSize_,
+                               MemoryResource* memRes_) :
+    PositionalReadable{this},
+    file{path_, accessMode_, getTransferSizeUnix(transferSize_), memRes_},
+    buffered{&file, getTransferSizeUnix(transferSize_), memRes_},
+    memRes{memRes_} {
+    // There is no distinction between binary and textual files on POSIX platforms
+    static_cast<void>(openMode_);
+}
+
+FileStreamUnix::~FileStreamUnix() {
+    // Data still pending in the buffer is written out
+    FileStreamUnix::close();
+}
+
+void FileStreamUnix::open() {
+    buffered.open();
+}
+
+void FileStreamUnix::close() {
+    buffered.close();
+}
+
+std::uint64_t FileStreamUnix::tell() {
+    return buffered.tell();
+}
+
+void FileStreamUnix::seek(std::uint64_t position) {
+    buffered.seek(position);
+}
+
+std::uint64_t FileStreamUnix::size() {
+    return buffered.size();
+}
+
+std::size_t FileStreamUnix::read(char* destination, std::size_t size) {
+    return buffered.read(destination, size);
+}
+
+std::size_t FileStreamUnix::read(Writable* destination, std::size_t size) {
+    return buffered.read(destination, size);
+}
+
+std::size_t FileStreamUnix::write(const char* source, std::size_t size) {
+    return buffered.write(source, size);
+}
+
+std::size_t FileStreamUnix::write(Readable* source, std::size_t size) {
+    return buffered.write(source, size);
+}
+
+bool FileStreamUnix::canReadAt() {
+    return file.canReadAt();
+}
+
+std::size_t FileStreamUnix::readAt(std::uint64_t position, char* destination, std::size_t size) {
+    // Bypasses the buffer, which never holds pending writes, as only read-only files are read positionally
+    return file.readAt(position, destination, size);
+}
+
+void FileStreamUnix::release() {
+    pma::PolyAllocator<FileStreamUnix> alloc{memRes};
+    alloc.deleteObject(this);
+}
+
+MemoryResource* FileStreamUnix::getMemoryResource() {
+    return memRes;
+}
+
+FileDescriptorStreamUnix::FileDescriptorStreamUnix(const char* path_,
+                                                   AccessMode accessMode_,
+                                                   std::size_t transferSize_,
+                                                   MemoryResource* memRes_) :
+    filePath{NativeStringConverter::from(path_, memRes_)},
+    fileAccessMode{accessMode_},
+    file{-1},
+    position{},
+    fileSize{getFileSizeUnix(filePath.c_str())},
+    transferBuffer{memRes_},
+    transferSize{transferSize_} {
+}
+
+FileDescriptorStreamUnix::~FileDescriptorStreamUnix() {
+    FileDescriptorStreamUnix::close();
+}
+
+void FileDescriptorStreamUnix::open() {
+    status->reset();
+    if (file != -1) {
+        status->set(AlreadyOpenError, filePath.c_str());
+        return;
+    }
+
+    // Same semantics as std::fstream: write-only access truncates the file, while read-write access preserves it
+    int openFlags{};
+    if (fileAccessMode == AccessMode::ReadWrite) {
+        openFlags = O_RDWR | O_CREAT;
+    } else if (fileAccessMode == AccessMode::Read) {
+        openFlags = O_RDONLY;
+    } else if (fileAccessMode == AccessMode::Write) {
+        openFlags = O_WRONLY | O_CREAT | O_TRUNC;
+    }
+    const int mode = (S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    file = ::open(filePath.c_str(), openFlags, mode);
+    if (file == -1) {
+        status->set(OpenError, filePath.c_str());
+        return;
+    }
+
+    struct stat st{};
+    if (::fstat(file, &st) != 0) {
+        ::close(file);
+        file = -1;
+        status->set(OpenError, filePath.c_str());
+        return;
+    }
+    fileSize = static_cast<std::uint64_t>(st.st_size);
+    position = 0ul;
+
+    #ifdef TRIO_FADVISE_AVAILABLE
+        // Only a hint (which enables larger read-ahead), so failure to apply it is not an error
+        static_cast<void>(::posix_fadvise(file, 0, 0, POSIX_FADV_SEQUENTIAL));
+    #endif  // TRIO_FADVISE_AVAILABLE
+}
+
+void FileDescriptorStreamUnix::close() {
+    if (file != -1) {
+        ::close(file);
+        file = -1;
+    }
+}
+
+std::uint64_t FileDescriptorStreamUnix::tell() {
+    return position;
+}
+
+void FileDescriptorStreamUnix::seek(std::uint64_t position_) {
+    const bool seekable = ((position_ == 0ul) || (position_ <= size())) && (file != -1);
+    if (!seekable) {
+        status->set(SeekError, filePath.c_str());
+        return;
+    }
+    position = position_;
+}
+
+std::uint64_t FileDescriptorStreamUnix::size() {
+    return fileSize;
+}
+
+std::size_t FileDescriptorStreamUnix::read(char* destination, std::size_t size) {
+    if ((destination == nullptr) || (file == -1) || !contains(fileAccessMode, AccessMode::Read)) {
+        status->set(ReadError, filePath.c_str());
+        return 0ul;
+    }
+    const std::size_t bytesRead = readAt(position, destination, size);
+    position += bytesRead;
+    return bytesRead;
+}
+
+std::size_t FileDescriptorStreamUnix::read(Writable* destination, std::size_t size) {
+    if ((destination == nullptr) || (file == -1) || !contains(fileAccessMode, AccessMode::Read)) {
+        status->set(ReadError, filePath.c_str());
+        return 0ul;
+    }
+
+    transferBuffer.resize(transferSize);
+    std::size_t bytesRead = 0ul;
+    while (bytesRead != size) {
+        const std::size_t chunkRead = readAt(position, transferBuffer.data(), std::min(size - bytesRead, transferSize));
+        if (chunkRead == 0ul) {
+            break;
+        }
+        position += chunkRead;
+        destination->write(transferBuffer.data(), chunkRead);
+        bytesRead += chunkRead;
+    }
+    return bytesRead;
+}
+
+std::size_t FileDescriptorStreamUnix::write(const char* source, std::size_t size) {
+    if ((source == nullptr) || (file == -1) || !contains(fileAccessMode, AccessMode::Write)) {
+        status->set(WriteError, filePath.c_str());
+        return 0ul;
+    }
+    return writeAt(source, size);
+}
+
+std::size_t FileDescriptorStreamUnix::write(Readable* source, std::size_t size) {
+    if ((source == nullptr) || (file == -1) || !contains(fileAccessMode, AccessMode::Write)) {
+        status->set(WriteError, filePath.c_str());
+        return 0ul;
+    }
+
+    transferBuffer.resize(transferSize);
+    std::size_t bytesWritten = 0ul;
+    while (bytesWritten != size) {
+        const std::size_t chunkSize = source->read(transferBuffer.data(), std::min(size - bytesWritten, transferSize));
+        if (chunkSize == 0ul) {
+            break;
+        }
+        const std::size_t chunkWritten = writeAt(transferBuffer.data(), chunkSize);
+        bytesWritten += chunkWritten;
+        if (chunkWritten != chunkSize) {
+            break;
+        }
+    }
+    return bytesWritten;
+}
+
+bool FileDescriptorStreamUnix::canReadAt() const {
+    return (file != -1) && (fileAccessMode == AccessMode::Read);
+}
+
+std::size_t FileDescriptorStreamUnix::readAt(std::uint64_t offset, char* destination, std::size_t size) {
+    if ((destination == nullptr) || (file == -1) || !contains(fileAccessMode, AccessMode::Read)) {
+        status->set(ReadError, filePath.c_str());
+        return 0ul;
+    }
+
+    std::size_t bytesRead = 0ul;
+    // A single request may be satisfied only partially, so it's repeated until all data is read, or the end of file is reached
+    while (bytesRead != size) {
+        const ssize_t result = ::pread(file, destination + bytesRead, size - bytesRead, static_cast<off_t>(offset + bytesRead));
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            status->set(ReadError, filePath.c_str());
+            break;
+        }
+        if (result == 0) {
+            break;
+        }
+        bytesRead += static_cast<std::size_t>(result);
+    }
+    return bytesRead;
+}
+
+std::size_t FileDescriptorStreamUnix::writeAt(const char* source, std::size_t size) {
+    std::size_t bytesWritten = 0ul;
+    while (bytesWritten != size) {
+        const ssize_t result = ::pwrite(file, source + bytesWritten, size - bytesWritten, static_cast<off_t>(position));
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            status->set(WriteError, filePath.c_str());
+            break;
+        }
+        bytesWritten += static_cast<std::size_t>(result);
+        position += static_cast<std::uint64_t>(result);
+    }
+    fileSize = std::max(position, fileSize);
+    return bytesWritten;
+}
+
+}  // namespace trio
+
+#endif  // TRIO_PREAD_AVAILABLE
+// *INDENT-ON*
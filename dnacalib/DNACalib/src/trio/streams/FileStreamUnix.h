@@ -0,0 +1,100 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+// *INDENT-OFF*
+#ifdef TRIO_PREAD_AVAILABLE
+
+#include "trio/streams/BufferedStreamImpl.h"
+#include "trio/streams/FileStreamBase.h"
+#include "trio/streams/PositionalReadable.h"
+#include "trio/streams/StreamStatus.h"
+#include "trio/types/Aliases.h"
+#include "trio/utils/NativeString.h"
+
+#include <pma/TypeDefs.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace trio {
+
+// Unbuffered access to a file through positional reads and writes on its descriptor
+class FileDescriptorStreamUnix : public BoundedIOStream {
+    public:
+        FileDescriptorStreamUnix(const char* path_, AccessMode accessMode_, std::size_t transferSize_, MemoryResource* memRes_);
+        ~FileDescriptorStreamUnix() override;
+
+        FileDescriptorStreamUnix(const FileDescriptorStreamUnix&) = delete;
+        FileDescriptorStreamUnix& operator=(const FileDescriptorStreamUnix&) = delete;
+
+        FileDescriptorStreamUnix(FileDescriptorStreamUnix&&) = delete;
+        FileDescriptorStreamUnix& operator=(FileDescriptorStreamUnix&&) = delete;
+
+        void open() override;
+        void close() override;
+        std::uint64_t tell() override;
+        void seek(std::uint64_t position_) override;
+        std::uint64_t size() override;
+        std::size_t read(char* destination, std::size_t size) override;
+        std::size_t read(Writable* destination, std::size_t size) override;
+        std::size_t write(const char* source, std::size_t size) override;
+        std::size_t write(Readable* source, std::size_t size) override;
+
+        // Positional reads, which leave the position of the stream unchanged, are possible only on read-only files
+        bool canReadAt() const;
+        std::size_t readAt(std::uint64_t offset, char* destination, std::size_t size);
+
+    private:
+        std::size_t writeAt(const char* source, std::size_t size);
+
+    private:
+        StreamStatus status;
+        NativeString filePath;
+        AccessMode fileAccessMode;
+        int file;
+        std::uint64_t position;
+        std::uint64_t fileSize;
+        // Intermediate buffer for transfers between the file and other streams, allocated on first use
+        Vector<char> transferBuffer;
+        std::size_t transferSize;
+};
+
+// Small reads and writes (e.g. of individual values) are served from a buffer of the transfer size, so the file
+// itself is accessed only in large requests
+class FileStreamUnix : public FileStreamBase, public PositionalReadable {
+    public:
+        FileStreamUnix(const char* path_, AccessMode accessMode_, OpenMode openMode_, std::size_t transferSize_, MemoryResource* memRes_);
+        ~FileStreamUnix() override;
+
+        FileStreamUnix(const FileStreamUnix&) = delete;
+        FileStreamUnix& operator=(const FileStreamUnix&) = delete;
+
+        FileStreamUnix(FileStreamUnix&&) = delete;
+        FileStreamUnix& operator=(FileStreamUnix&&) = delete;
+
+        void open() override;
+        void close() override;
+        std::uint64_t tell() override;
+        void seek(std::uint64_t position) override;
+        std::uint64_t size() override;
+        std::size_t read(char* destination, std::size_t size) override;
+        std::size_t read(Writable* destination, std::size_t size) override;
+        std::size_t write(const char* source, std::size_t size) override;
+        std::size_t write(Readable* source, std::size_t size) override;
+        void release() override;
+        bool canReadAt() override;
+        std::size_t readAt(std::uint64_t position, char* destination, std::size_t size) override;
+
+        MemoryResource* getMemoryResource();
+
+    private:
+        FileDescriptorStreamUnix file;
+        BufferedStreamImpl buffered;
+        MemoryResource* memRes;
+};
+
+}  // namespace trio
+
+#endif  // TRIO_PREAD_AVAILABLE
+// *INDENT-ON*
@@ -23,6 +23,21 @@ MemoryMappedFileStream* MemoryMappedFileStream::create(const char* path, AccessM
     return alloc.newObject(path, accessMode, memRes);
 }
 
+MemoryMappedFileStream* MemoryMappedFileStream::create(const char* path,
+                                                       AccessMode accessMode,
+                                                       MappingPolicy mappingPolicy,
+                                                       bool hugePageAlignment,
+                                                       MemoryResource* memRes) {
+    #if !defined(TRIO_WINDOWS_FILE_MAPPING_AVAILABLE) && defined(TRIO_MMAP_AVAILABLE)
+        pma::PolyAllocator<MemoryMappedFileStreamImpl> alloc{memRes};
+        return alloc.newObject(path, accessMode, mappingPolicy, hugePageAlignment, memRes);
+    #else
+        static_cast<void>(mappingPolicy);
+        static_cast<void>(hugePageAlignment);
+        return create(path, accessMode, memRes);
+    #endif
+}
+
 void MemoryMappedFileStream::destroy(MemoryMappedFileStream* instance) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
     auto stream = static_cast<MemoryMappedFileStreamImpl*>(instance);
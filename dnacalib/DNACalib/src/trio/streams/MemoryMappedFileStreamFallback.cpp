@@ -64,6 +64,11 @@ void MemoryMappedFileStreamFallback::resize(std::uint64_t  /*unused*/) {
     // No-op, as it's written to disk directly
 }
 
+const char* MemoryMappedFileStreamFallback::view(std::uint64_t  /*unused*/, std::size_t  /*unused*/) {
+    // Nothing is mapped, so direct access is not possible
+    return nullptr;
+}
+
 std::uint64_t MemoryMappedFileStreamFallback::size() {
     return stream->size();
 }
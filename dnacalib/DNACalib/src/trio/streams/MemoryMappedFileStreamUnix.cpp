@@ -40,6 +40,8 @@ namespace trio {
 namespace {
 
 constexpr std::size_t minViewSizeUnix = 65536ul;
+// Size of transparent huge pages on the most common platforms (x86-64 and AArch64 with 4K base pages)
+constexpr std::size_t hugePageSizeUnix = 2ul * 1024ul * 1024ul;
 
 inline std::uint64_t getFileSizeUnix(const NativeCharacter* path) {
     struct stat st{};
@@ -105,6 +107,7 @@ private:
 }  // namespace
 
 MemoryMappedFileStreamUnix::MemoryMappedFileStreamUnix(const char* path_, AccessMode accessMode_, MemoryResource* memRes_) :
+    PositionalReadable{this},
     filePath{NativeStringConverter::from(path_, memRes_)},
     fileAccessMode{accessMode_},
     memRes{memRes_},
@@ -115,7 +118,21 @@ MemoryMappedFileStreamUnix::MemoryMappedFileStreamUnix(const char* path_, Access
     viewOffset{},
     viewSize{},
     delayedMapping{false},
-    dirty{false} {
+    dirty{false},
+    wholeFileMapping{false},
+    mappingPolicy{MappingPolicy::Default},
+    hugePageAlignment{false} {
+}
+
+MemoryMappedFileStreamUnix::MemoryMappedFileStreamUnix(const char* path_,
+                                                       AccessMode accessMode_,
+                                                       MappingPolicy mappingPolicy_,
+                                                       bool hugePageAlignment_,
+                                                       MemoryResource* memRes_) :
+    MemoryMappedFileStreamUnix{path_, accessMode_, memRes_} {
+    wholeFileMapping = (accessMode_ == AccessMode::Read);
+    mappingPolicy = mappingPolicy_;
+    hugePageAlignment = hugePageAlignment_;
 }
 
 MemoryMappedFileStreamUnix::~MemoryMappedFileStreamUnix() {
@@ -161,13 +178,14 @@ void MemoryMappedFileStreamUnix::open() {
     }
 
     mapFile(0ul, fileSize);
-    if (data == reinterpret_cast<void*>(-1)) {
+    if ((data == reinterpret_cast<void*>(-1)) || (wholeFileMapping && !mapsWholeFile())) {
         status->set(OpenError, filePath.c_str());
         delayedMapping = false;
         unmapFile();
         closeFile();
         return;
     }
+    adviseMapping();
 
     MemoryMappedFileStreamUnix::seek(0ul);
     dirty = false;
@@ -193,7 +211,9 @@ void MemoryMappedFileStreamUnix::seek(std::uint64_t position_) {
     }
 
     position = position_;
-    if ((position < viewOffset) || (position >= (viewOffset + viewSize))) {
+    // While the whole file is mapped, every valid position is within the view (including the end of file), so remapping
+    // is never needed (which also keeps pointers obtained through view valid)
+    if (!mapsWholeFile() && ((position < viewOffset) || (position >= (viewOffset + viewSize)))) {
         flush();
         if (dirty) {
             return;
@@ -397,6 +417,46 @@ void MemoryMappedFileStreamUnix::resize(std::uint64_t size) {
     }
 }
 
+const char* MemoryMappedFileStreamUnix::view(std::uint64_t position_, std::size_t size) {
+    // Only read-only views are handed out, as they cannot be used to modify the underlying file
+    if ((fileAccessMode != AccessMode::Read) || !mapsWholeFile() || (position_ > fileSize) || (size > fileSize - position_)) {
+        return nullptr;
+    }
+    return static_cast<char*>(data) + position_;
+}
+
+bool MemoryMappedFileStreamUnix::canReadAt() {
+    return (fileAccessMode == AccessMode::Read) && mapsWholeFile();
+}
+
+std::size_t MemoryMappedFileStreamUnix::readAt(std::uint64_t position_, char* destination, std::size_t size) {
+    if ((destination == nullptr) || (position_ > fileSize)) {
+        status->set(ReadError, filePath.c_str());
+        return 0ul;
+    }
+
+    #if !defined(__clang__) && defined(__GNUC__)
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wuseless-cast"
+    #endif
+    const auto bytesToRead = static_cast<std::size_t>(std::min(static_cast<std::uint64_t>(size), fileSize - position_));
+    #if !defined(__clang__) && defined(__GNUC__)
+        #pragma GCC diagnostic pop
+    #endif
+    // Served straight from the mapping, which is shared by all threads
+    const char* source = view(position_, bytesToRead);
+    if (source == nullptr) {
+        status->set(ReadError, filePath.c_str());
+        return 0ul;
+    }
+    std::memcpy(destination, source, bytesToRead);
+    return bytesToRead;
+}
+
+bool MemoryMappedFileStreamUnix::mapsWholeFile() const {
+    return (data != nullptr) && (viewOffset == 0ul) && (viewSize >= fileSize);
+}
+
 void MemoryMappedFileStreamUnix::openFile() {
     int openFlags{};
     if (fileAccessMode == AccessMode::ReadWrite) {
@@ -424,7 +484,10 @@ void MemoryMappedFileStreamUnix::mapFile(std::uint64_t offset, std::uint64_t siz
     prot |= (contains(fileAccessMode, AccessMode::Write) ? PROT_WRITE : prot);
     prot |= (contains(fileAccessMode, AccessMode::Read) ? PROT_READ : prot);
 
-    const int flags = (fileAccessMode == AccessMode::Read ? MAP_PRIVATE : MAP_SHARED);
+    int flags = (fileAccessMode == AccessMode::Read ? MAP_PRIVATE : MAP_SHARED);
+    #ifdef MAP_POPULATE
+        flags |= ((wholeFileMapping && (mappingPolicy == MappingPolicy::Populate)) ? MAP_POPULATE : 0);
+    #endif  // MAP_POPULATE
 
     const std::uint64_t alignedOffset = alignOffsetUnix(offset);
 
@@ -440,17 +503,22 @@ void MemoryMappedFileStreamUnix::mapFile(std::uint64_t offset, std::uint64_t siz
         #pragma GCC diagnostic pop
     #endif
 
-    // Try mapping requested size, but if it fails keep repeating by halving the view size each time (e.g. if not enough VA space)
-    std::size_t nextSize = safeSize;
-    do {
-        safeSize = nextSize;
-        data = ::mmap(nullptr, safeSize, prot, flags, file, static_cast<off_t>(alignedOffset));
-        if (data != reinterpret_cast<void*>(-1)) {
-            break;
+    if (wholeFileMapping) {
+        // Partial views are of no use here, as the whole file must be mapped at once
+        data = (hugePageAlignment ? mapAligned(safeSize, prot, flags, hugePageSizeUnix) : ::mmap(nullptr, safeSize, prot, flags, file, 0));
+    } else {
+        // Try mapping requested size, but if it fails keep repeating by halving the view size each time (e.g. if not enough VA space)
+        std::size_t nextSize = safeSize;
+        do {
+            safeSize = nextSize;
+            data = ::mmap(nullptr, safeSize, prot, flags, file, static_cast<off_t>(alignedOffset));
+            if (data != reinterpret_cast<void*>(-1)) {
+                break;
+            }
+            nextSize = safeSize / 2ul;
         }
-        nextSize = safeSize / 2ul;
+        while (nextSize > minViewSizeUnix);
     }
-    while (nextSize > minViewSizeUnix);
 
     if (data != reinterpret_cast<void*>(-1)) {
         viewOffset = alignedOffset;
@@ -458,6 +526,65 @@ void MemoryMappedFileStreamUnix::mapFile(std::uint64_t offset, std::uint64_t siz
     }
 }
 
+void* MemoryMappedFileStreamUnix::mapAligned(std::size_t size, int prot, int flags, std::size_t alignment) {
+    // Reserve an address range large enough to contain an aligned one, map the file over the aligned part of it,
+    // and release the rest
+    const std::size_t reservedSize = size + alignment;
+    void* reserved = ::mmap(nullptr, reservedSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reserved == reinterpret_cast<void*>(-1)) {
+        return ::mmap(nullptr, size, prot, flags, file, 0);
+    }
+
+    const auto reservedStart = reinterpret_cast<std::uintptr_t>(reserved);
+    const auto reservedEnd = reservedStart + reservedSize;
+    const auto alignedStart = (reservedStart + alignment - 1ul) / alignment * alignment;
+    void* mapped = ::mmap(reinterpret_cast<void*>(alignedStart), size, prot, flags | MAP_FIXED, file, 0);
+    if (mapped == reinterpret_cast<void*>(-1)) {
+        ::munmap(reserved, reservedSize);
+        return ::mmap(nullptr, size, prot, flags, file, 0);
+    }
+
+    #if !defined(__clang__) && defined(__GNUC__)
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wuseless-cast"
+    #endif
+    const auto pageSize = static_cast<std::uintptr_t>(getPageSizeUnix());
+    #if !defined(__clang__) && defined(__GNUC__)
+        #pragma GCC diagnostic pop
+    #endif
+    const auto mappedEnd = (alignedStart + size + pageSize - 1ul) / pageSize * pageSize;
+    if (alignedStart != reservedStart) {
+        ::munmap(reserved, alignedStart - reservedStart);
+    }
+    if (mappedEnd < reservedEnd) {
+        ::munmap(reinterpret_cast<void*>(mappedEnd), reservedEnd - mappedEnd);
+    }
+
+    #ifdef MADV_HUGEPAGE
+        // Only a hint, so failure to apply it is not an error
+        static_cast<void>(::madvise(mapped, size, MADV_HUGEPAGE));
+    #endif  // MADV_HUGEPAGE
+    return mapped;
+}
+
+void MemoryMappedFileStreamUnix::adviseMapping() {
+    if (!wholeFileMapping) {
+        return;
+    }
+    // Only hints, so failure to apply them is not an error
+    if (mappingPolicy == MappingPolicy::Sequential) {
+        static_cast<void>(::posix_madvise(data, viewSize, POSIX_MADV_SEQUENTIAL));
+    } else if (mappingPolicy == MappingPolicy::WillNeed) {
+        static_cast<void>(::posix_madvise(data, viewSize, POSIX_MADV_WILLNEED));
+    }
+    #ifndef MAP_POPULATE
+        else if (mappingPolicy == MappingPolicy::Populate) {
+            // Without support for populating the mapping when it's created, fallback to reading it in advance
+            static_cast<void>(::posix_madvise(data, viewSize, POSIX_MADV_WILLNEED));
+        }
+    #endif  // MAP_POPULATE
+}
+
 void MemoryMappedFileStreamUnix::unmapFile() {
     if (data != nullptr) {
         ::munmap(data, viewSize);
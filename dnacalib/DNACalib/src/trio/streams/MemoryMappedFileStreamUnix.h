@@ -6,6 +6,7 @@
 #ifdef TRIO_MMAP_AVAILABLE
 
 #include "trio/streams/MemoryMappedFileStream.h"
+#include "trio/streams/PositionalReadable.h"
 #include "trio/streams/StreamStatus.h"
 #include "trio/types/Aliases.h"
 #include "trio/utils/NativeString.h"
@@ -16,9 +17,14 @@
 
 namespace trio {
 
-class MemoryMappedFileStreamUnix : public MemoryMappedFileStream {
+class MemoryMappedFileStreamUnix : public MemoryMappedFileStream, public PositionalReadable {
     public:
         MemoryMappedFileStreamUnix(const char* path_, AccessMode accessMode_, MemoryResource* memRes_);
+        MemoryMappedFileStreamUnix(const char* path_,
+                                   AccessMode accessMode_,
+                                   MappingPolicy mappingPolicy_,
+                                   bool hugePageAlignment_,
+                                   MemoryResource* memRes_);
         ~MemoryMappedFileStreamUnix();
 
         MemoryMappedFileStreamUnix(const MemoryMappedFileStreamUnix&) = delete;
@@ -38,13 +44,19 @@ class MemoryMappedFileStreamUnix : public MemoryMappedFileStream {
         std::size_t write(Readable* source, std::size_t size) override;
         void flush() override;
         void resize(std::uint64_t size) override;
+        const char* view(std::uint64_t position, std::size_t size) override;
+        bool canReadAt() override;
+        std::size_t readAt(std::uint64_t position, char* destination, std::size_t size) override;
 
         MemoryResource* getMemoryResource();
 
     private:
+        bool mapsWholeFile() const;
         void openFile();
         void closeFile();
         void mapFile(std::uint64_t offset, std::uint64_t size);
+        void* mapAligned(std::size_t size, int prot, int flags, std::size_t alignment);
+        void adviseMapping();
         void unmapFile();
         void resizeFile(std::uint64_t size);
 
@@ -61,6 +73,10 @@ class MemoryMappedFileStreamUnix : public MemoryMappedFileStream {
         std::size_t viewSize;
         bool delayedMapping;
         bool dirty;
+        // Read-only streams created with a mapping policy map the whole file once, or fail to open
+        bool wholeFileMapping;
+        MappingPolicy mappingPolicy;
+        bool hugePageAlignment;
 };
 
 }  // namespace trio
@@ -97,6 +97,7 @@ private:
 }  // namespace
 
 MemoryMappedFileStreamWindows::MemoryMappedFileStreamWindows(const char* path_, AccessMode accessMode_, MemoryResource* memRes_) :
+    PositionalReadable{this},
     filePath{NativeStringConverter::from(path_, memRes_)},
     fileAccessMode{accessMode_},
     memRes{memRes_},
@@ -191,7 +192,9 @@ void MemoryMappedFileStreamWindows::seek(std::uint64_t position_) {
     }
 
     position = position_;
-    if ((position < viewOffset) || (position >= (viewOffset + viewSize))) {
+    // While the whole file is mapped, every valid position is within the view (including the end of file), so remapping
+    // is never needed (which also keeps pointers obtained through view valid)
+    if (!mapsWholeFile() && ((position < viewOffset) || (position >= (viewOffset + viewSize)))) {
         flush();
         if (dirty) {
             return;
@@ -360,6 +363,46 @@ void MemoryMappedFileStreamWindows::resize(std::uint64_t size) {
     }
 }
 
+const char* MemoryMappedFileStreamWindows::view(std::uint64_t position_, std::size_t size) {
+    // Only read-only views are handed out, as they cannot be used to modify the underlying file
+    if ((fileAccessMode != AccessMode::Read) || !mapsWholeFile() || (position_ > fileSize) || (size > fileSize - position_)) {
+        return nullptr;
+    }
+    return static_cast<char*>(data) + position_;
+}
+
+bool MemoryMappedFileStreamWindows::canReadAt() {
+    return (fileAccessMode == AccessMode::Read) && mapsWholeFile();
+}
+
+std::size_t MemoryMappedFileStreamWindows::readAt(std::uint64_t position_, char* destination, std::size_t size) {
+    if ((destination == nullptr) || (position_ > fileSize)) {
+        status->set(ReadError, filePath.c_str());
+        return 0ul;
+    }
+
+    #if !defined(__clang__) && defined(__GNUC__)
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wuseless-cast"
+    #endif
+    const auto bytesToRead = static_cast<std::size_t>(std::min(static_cast<std::uint64_t>(size), fileSize - position_));
+    #if !defined(__clang__) && defined(__GNUC__)
+        #pragma GCC diagnostic pop
+    #endif
+    // Served straight from the mapping, which is shared by all threads
+    const char* source = view(position_, bytesToRead);
+    if (source == nullptr) {
+        status->set(ReadError, filePath.c_str());
+        return 0ul;
+    }
+    std::memcpy(destination, source, bytesToRead);
+    return bytesToRead;
+}
+
+bool MemoryMappedFileStreamWindows::mapsWholeFile() const {
+    return (data != nullptr) && (viewOffset == 0ul) && (viewSize >= fileSize);
+}
+
 void MemoryMappedFileStreamWindows::openFile() {
     DWORD access{GENERIC_READ};
     access |= (contains(fileAccessMode, AccessMode::Write) ? GENERIC_WRITE : access);
@@ -6,6 +6,7 @@
 #ifdef TRIO_WINDOWS_FILE_MAPPING_AVAILABLE
 
 #include "trio/streams/MemoryMappedFileStream.h"
+#include "trio/streams/PositionalReadable.h"
 #include "trio/streams/StreamStatus.h"
 #include "trio/types/Aliases.h"
 #include "trio/utils/NativeString.h"
@@ -18,7 +19,7 @@
 
 namespace trio {
 
-class MemoryMappedFileStreamWindows : public MemoryMappedFileStream {
+class MemoryMappedFileStreamWindows : public MemoryMappedFileStream, public PositionalReadable {
     public:
         MemoryMappedFileStreamWindows(const char* path_, AccessMode accessMode_, MemoryResource* memRes_);
         ~MemoryMappedFileStreamWindows();
@@ -40,10 +41,14 @@ class MemoryMappedFileStreamWindows : public MemoryMappedFileStream {
         std::size_t write(Readable* source, std::size_t size) override;
         void flush() override;
         void resize(std::uint64_t size) override;
+        const char* view(std::uint64_t position, std::size_t size) override;
+        bool canReadAt() override;
+        std::size_t readAt(std::uint64_t position, char* destination, std::size_t size) override;
 
         MemoryResource* getMemoryResource();
 
     private:
+        bool mapsWholeFile() const;
         void openFile();
         void closeFile();
         void mapFile(std::uint64_t offset, std::uint64_t size);
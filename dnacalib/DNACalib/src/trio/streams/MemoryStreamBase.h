@@ -0,0 +1,17 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "trio/streams/MemoryStream.h"
+
+namespace trio {
+
+// Common base of all MemoryStream implementations, through which instances can be destroyed without knowing
+// whether they own their contents or only refer to an external buffer
+class MemoryStreamBase : public MemoryStream {
+    public:
+        virtual void release() = 0;
+
+};
+
+}  // namespace trio
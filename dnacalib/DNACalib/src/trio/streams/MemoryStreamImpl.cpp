@@ -2,6 +2,8 @@
 
 #include "trio/streams/MemoryStreamImpl.h"
 
+#include "trio/streams/MemoryStreamView.h"
+
 #include <pma/PolyAllocator.h>
 
 #ifdef _MSC_VER
@@ -75,14 +77,19 @@ MemoryStream* MemoryStream::create(std::size_t initialSize, MemoryResource* memR
     return alloc.newObject(initialSize, memRes);
 }
 
+MemoryStream* MemoryStream::createView(const char* buffer, std::size_t size, MemoryResource* memRes) {
+    pma::PolyAllocator<MemoryStreamView> alloc{memRes};
+    return alloc.newObject(buffer, size, memRes);
+}
+
 void MemoryStream::destroy(MemoryStream* instance) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-    auto stream = static_cast<MemoryStreamImpl*>(instance);
-    pma::PolyAllocator<MemoryStreamImpl> alloc{stream->getMemoryResource()};
-    alloc.deleteObject(stream);
+    auto stream = static_cast<MemoryStreamBase*>(instance);
+    stream->release();
 }
 
 MemoryStreamImpl::MemoryStreamImpl(std::size_t initialSize, MemoryResource* memRes_) :
+    PositionalReadable{this},
     data{initialSize, static_cast<char>(0), memRes_},
     position{},
     memRes{memRes_} {
@@ -138,6 +145,31 @@ std::size_t MemoryStreamImpl::read(Writable* destination, std::size_t size) {
     return bytesCopied;
 }
 
+bool MemoryStreamImpl::canReadAt() {
+    return true;
+}
+
+std::size_t MemoryStreamImpl::readAt(std::uint64_t position_, char* destination, std::size_t size) {
+    if ((destination == nullptr) || (position_ > data.size())) {
+        status->set(ReadError);
+        return 0ul;
+    }
+
+    #if !defined(__clang__) && defined(__GNUC__)
+        #pragma GCC diagnostic push
+        #pragma GCC diagnostic ignored "-Wuseless-cast"
+    #endif
+    const auto offset = static_cast<std::size_t>(position_);
+    #if !defined(__clang__) && defined(__GNUC__)
+        #pragma GCC diagnostic pop
+    #endif
+    const std::size_t bytesToRead = std::min(size, data.size() - offset);
+    if (bytesToRead > 0ul) {
+        std::memcpy(destination, data.data() + offset, bytesToRead);
+    }
+    return bytesToRead;
+}
+
 std::size_t MemoryStreamImpl::write(const char* source, std::size_t size) {
     if (source == nullptr) {
         status->set(WriteError);
@@ -172,6 +204,11 @@ std::uint64_t MemoryStreamImpl::size() {
     return data.size();
 }
 
+void MemoryStreamImpl::release() {
+    pma::PolyAllocator<MemoryStreamImpl> alloc{memRes};
+    alloc.deleteObject(this);
+}
+
 MemoryResource* MemoryStreamImpl::getMemoryResource() {
     return memRes;
 }
@@ -2,7 +2,8 @@
 
 #pragma once
 
-#include "trio/streams/MemoryStream.h"
+#include "trio/streams/MemoryStreamBase.h"
+#include "trio/streams/PositionalReadable.h"
 #include "trio/streams/StreamStatus.h"
 #include "trio/types/Aliases.h"
 
@@ -21,7 +22,7 @@
 
 namespace trio {
 
-class MemoryStreamImpl : public MemoryStream {
+class MemoryStreamImpl : public MemoryStreamBase, public PositionalReadable {
     public:
         MemoryStreamImpl(std::size_t initialSize, MemoryResource* memRes_);
 
@@ -34,6 +35,9 @@ class MemoryStreamImpl : public MemoryStream {
         std::size_t read(Writable* destination, std::size_t size) override;
         std::size_t write(const char* source, std::size_t size) override;
         std::size_t write(Readable* source, std::size_t size) override;
+        void release() override;
+        bool canReadAt() override;
+        std::size_t readAt(std::uint64_t position_, char* destination, std::size_t size) override;
 
         MemoryResource* getMemoryResource();
 
@@ -0,0 +1,105 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "trio/streams/MemoryStreamView.h"
+
+#include <pma/PolyAllocator.h>
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace trio {
+
+MemoryStreamView::MemoryStreamView(const char* buffer_, std::size_t bufferSize_, MemoryResource* memRes_) :
+    buffer{buffer_},
+    bufferSize{(buffer_ == nullptr ? 0ul : bufferSize_)},
+    position{},
+    memRes{memRes_} {
+}
+
+void MemoryStreamView::open() {
+    position = 0ul;
+}
+
+void MemoryStreamView::close() {
+    position = 0ul;
+}
+
+std::uint64_t MemoryStreamView::tell() {
+    return position;
+}
+
+void MemoryStreamView::seek(std::uint64_t position_) {
+    if ((position_ == 0ul) || (position_ <= size())) {
+        #if !defined(__clang__) && defined(__GNUC__)
+            #pragma GCC diagnostic push
+            #pragma GCC diagnostic ignored "-Wuseless-cast"
+        #endif
+        position = static_cast<std::size_t>(position_);
+        #if !defined(__clang__) && defined(__GNUC__)
+            #pragma GCC diagnostic pop
+        #endif
+    } else {
+        status->set(SeekError);
+    }
+}
+
+std::uint64_t MemoryStreamView::size() {
+    return bufferSize;
+}
+
+std::size_t MemoryStreamView::read(char* destination, std::size_t size) {
+    if (destination == nullptr) {
+        status->set(ReadError);
+        return 0ul;
+    }
+
+    const std::size_t bytesToRead = std::min(size, bufferSize - position);
+    if (bytesToRead > 0ul) {
+        std::memcpy(destination, buffer + position, bytesToRead);
+    }
+    position += bytesToRead;
+    return bytesToRead;
+}
+
+std::size_t MemoryStreamView::read(Writable* destination, std::size_t size) {
+    if (destination == nullptr) {
+        status->set(ReadError);
+        return 0ul;
+    }
+
+    const std::size_t bytesToRead = std::min(size, bufferSize - position);
+    const std::size_t bytesCopied = (bytesToRead > 0ul ? destination->write(buffer + position, bytesToRead) : 0ul);
+    position += bytesCopied;
+    return bytesCopied;
+}
+
+std::size_t MemoryStreamView::write(const char*  /*unused*/, std::size_t  /*unused*/) {
+    // The viewed buffer is not owned by the stream, so it is never modified
+    status->set(WriteError);
+    return 0ul;
+}
+
+std::size_t MemoryStreamView::write(Readable*  /*unused*/, std::size_t  /*unused*/) {
+    status->set(WriteError);
+    return 0ul;
+}
+
+void MemoryStreamView::release() {
+    pma::PolyAllocator<MemoryStreamView> alloc{memRes};
+    alloc.deleteObject(this);
+}
+
+MemoryResource* MemoryStreamView::getMemoryResource() {
+    return memRes;
+}
+
+}  // namespace trio
@@ -0,0 +1,49 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "trio/streams/MemoryStreamBase.h"
+#include "trio/streams/StreamStatus.h"
+#include "trio/types/Aliases.h"
+
+#include <pma/TypeDefs.h>
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <cstddef>
+#include <cstdint>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace trio {
+
+// Read-only stream over an externally owned buffer, which is never copied
+class MemoryStreamView : public MemoryStreamBase {
+    public:
+        MemoryStreamView(const char* buffer_, std::size_t bufferSize_, MemoryResource* memRes_);
+
+        void open() override;
+        void close() override;
+        std::uint64_t tell() override;
+        void seek(std::uint64_t position_) override;
+        std::uint64_t size() override;
+        std::size_t read(char* destination, std::size_t size) override;
+        std::size_t read(Writable* destination, std::size_t size) override;
+        std::size_t write(const char* source, std::size_t size) override;
+        std::size_t write(Readable* source, std::size_t size) override;
+        void release() override;
+
+        MemoryResource* getMemoryResource();
+
+    private:
+        StreamStatus status;
+        const char* buffer;
+        std::size_t bufferSize;
+        std::size_t position;
+        MemoryResource* memRes;
+};
+
+}  // namespace trio
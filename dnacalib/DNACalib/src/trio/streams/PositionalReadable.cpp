@@ -0,0 +1,54 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "trio/streams/PositionalReadable.h"
+
+#include <pma/TypeDefs.h>
+#include <pma/resources/DefaultMemoryResource.h>
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <mutex>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace trio {
+
+namespace {
+
+struct Registry {
+    std::mutex lock;
+    pma::DefaultMemoryResource memRes;
+    pma::UnorderedMap<const BoundedIOStream*, PositionalReadable*> entries{&memRes};
+};
+
+Registry& getRegistry() {
+    // Never destroyed, so streams which outlive static destruction can still deregister themselves
+    static Registry* registry = new Registry{};
+    return *registry;
+}
+
+}  // namespace
+
+PositionalReadable* PositionalReadable::find(const BoundedIOStream* stream) {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock{registry.lock};
+    auto it = registry.entries.find(stream);
+    return (it == registry.entries.end() ? nullptr : it->second);
+}
+
+PositionalReadable::PositionalReadable(const BoundedIOStream* stream_) : stream{stream_} {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock{registry.lock};
+    registry.entries[stream] = this;
+}
+
+PositionalReadable::~PositionalReadable() {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock{registry.lock};
+    registry.entries.erase(stream);
+}
+
+}  // namespace trio
@@ -0,0 +1,47 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "trio/Stream.h"
+
+#ifdef _MSC_VER
+    #pragma warning(push)
+    #pragma warning(disable : 4365 4987)
+#endif
+#include <cstddef>
+#include <cstdint>
+#ifdef _MSC_VER
+    #pragma warning(pop)
+#endif
+
+namespace trio {
+
+// Implemented by the streams which can read from any position without moving their own, so multiple threads may read
+// different parts of the same stream concurrently, as long as it's neither written to nor closed meanwhile.
+// Streams register themselves for their whole lifetime, so they can be found through their BoundedIOStream interface
+// without relying on RTTI.
+class PositionalReadable {
+    public:
+        // Returns nullptr if the given stream does not support positional reads
+        static PositionalReadable* find(const BoundedIOStream* stream);
+
+        // Whether positional reads are possible in the current state of the stream (e.g. only while it's open)
+        virtual bool canReadAt() = 0;
+        // Returns the number of bytes read, which is less than requested only at the end of the stream or on errors
+        virtual std::size_t readAt(std::uint64_t position, char* destination, std::size_t size) = 0;
+
+    protected:
+        explicit PositionalReadable(const BoundedIOStream* stream_);
+        virtual ~PositionalReadable();
+
+        PositionalReadable(const PositionalReadable&) = delete;
+        PositionalReadable& operator=(const PositionalReadable&) = delete;
+
+        PositionalReadable(PositionalReadable&&) = delete;
+        PositionalReadable& operator=(PositionalReadable&&) = delete;
+
+    private:
+        const BoundedIOStream* stream;
+};
+
+}  // namespace trio
@@ -0,0 +1,82 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "fixtures/TestDNA.h"
+
+#include <dna/Reader.h>
+#include <dnacalib/commands/RenameJointCommand.h>
+#include <dnacalib/dna/DNACalibDNAReader.h>
+#include <pma/ScopedPtr.h>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+namespace {
+
+class ReaderTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            reader = fixtures::readTestDNA(fixtures::makeTestDNA());
+            ASSERT_TRUE(dna::Status::isOk());
+        }
+
+    protected:
+        pma::ScopedPtr<dna::BinaryStreamReader> reader;
+};
+
+}  // namespace
+
+TEST_F(ReaderTest, MemoryReportOfGeometryIsTheSumOfAllMeshes) {
+    const auto report = dna::getMemoryReport(reader.get());
+    std::size_t geometry = 0ul;
+    for (std::uint16_t meshIndex = 0u; meshIndex < reader->getMeshCount(); ++meshIndex) {
+        const auto meshReport = dna::getMeshMemoryReport(reader.get(), meshIndex);
+        ASSERT_EQ(meshReport.positions, reader->getVertexPositionCount(meshIndex) * 3ul * sizeof(float));
+        geometry += meshReport.total();
+    }
+    ASSERT_GT(report.names, 0ul);
+    ASSERT_GT(report.jointGroups, 0ul);
+    ASSERT_GT(geometry, 0ul);
+    ASSERT_EQ(report.geometry, geometry);
+}
+
+TEST_F(ReaderTest, MemoryReportSkipsUnloadedLayers) {
+    reader->unload(dna::DataLayer::Geometry);
+    const auto report = dna::getMemoryReport(reader.get());
+    ASSERT_EQ(report.geometry, 0ul);
+    ASSERT_EQ(dna::getMeshMemoryReport(reader.get(), 0u).total(), 0ul);
+    ASSERT_GT(report.jointGroups, 0ul);
+}
+
+TEST_F(ReaderTest, MemoryReportOfCalibrationReaderMatchesItsSource) {
+    auto calibrated = pma::makeScoped<dnac::DNACalibDNAReader>(reader.get());
+    const auto expected = dna::getMemoryReport(reader.get());
+    const auto actual = dna::getMemoryReport(calibrated.get());
+    ASSERT_EQ(actual.geometry, expected.geometry);
+    ASSERT_EQ(actual.names, expected.names);
+    ASSERT_EQ(actual.jointGroups, expected.jointGroups);
+}
+
+TEST_F(ReaderTest, NamesAreLookedUpByTheirIndex) {
+    for (std::uint16_t jointIndex = 0u; jointIndex < reader->getJointCount(); ++jointIndex) {
+        ASSERT_EQ(dna::getJointIndexByName(reader.get(), reader->getJointName(jointIndex).c_str()), jointIndex);
+    }
+    for (std::uint16_t meshIndex = 0u; meshIndex < reader->getMeshCount(); ++meshIndex) {
+        ASSERT_EQ(dna::getMeshIndexByName(reader.get(), reader->getMeshName(meshIndex).c_str()), meshIndex);
+    }
+    ASSERT_EQ(dna::getJointIndexByName(reader.get(), "missing"), std::numeric_limits<std::uint16_t>::max());
+    ASSERT_EQ(dna::getJointIndexByName(reader.get(), nullptr), std::numeric_limits<std::uint16_t>::max());
+}
+
+TEST_F(ReaderTest, RenamedNamesAreLookedUpUnderTheirNewName) {
+    auto calibrated = pma::makeScoped<dnac::DNACalibDNAReader>(reader.get());
+    const std::string oldName = calibrated->getJointName(1u).c_str();
+    ASSERT_EQ(dna::getJointIndexByName(calibrated.get(), oldName.c_str()), 1u);
+    dnac::RenameJointCommand rename{oldName.c_str(), "renamed"};
+    rename.run(calibrated.get());
+    ASSERT_EQ(dna::getJointIndexByName(calibrated.get(), "renamed"), 1u);
+    ASSERT_EQ(dna::getJointIndexByName(calibrated.get(), oldName.c_str()), std::numeric_limits<std::uint16_t>::max());
+}
@@ -0,0 +1,58 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "fixtures/TestDNA.h"
+
+#include <dna/BinaryStreamWriter.h>
+#include <pma/ScopedPtr.h>
+#include <trio/streams/MemoryStream.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+class WriterTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            expected = fixtures::readTestDNA(fixtures::makeTestDNA());
+            ASSERT_TRUE(dna::Status::isOk());
+        }
+
+        std::vector<char> copy(dna::DataLayer layer) {
+            auto stream = pma::makeScoped<trio::MemoryStream>();
+            auto writer = pma::makeScoped<dna::BinaryStreamWriter>(stream.get());
+            writer->setFrom(expected.get(), layer);
+            writer->write();
+            std::vector<char> buffer(stream->size());
+            stream->open();
+            stream->seek(0ul);
+            stream->read(buffer.data(), buffer.size());
+            stream->close();
+            return buffer;
+        }
+
+    protected:
+        pma::ScopedPtr<dna::BinaryStreamReader> expected;
+};
+
+}  // namespace
+
+TEST_F(WriterTest, SetFromCopiesAllLayers) {
+    auto actual = fixtures::readTestDNA(copy(dna::DataLayer::All));
+    ASSERT_TRUE(dna::Status::isOk());
+    fixtures::expectEqual(expected.get(), actual.get());
+}
+
+TEST_F(WriterTest, SetFromCopiesOnlyTheGivenLayers) {
+    auto actual = fixtures::readTestDNA(copy(dna::DataLayer::GeometryWithoutBlendShapes));
+    ASSERT_TRUE(dna::Status::isOk());
+    ASSERT_EQ(actual->getMeshCount(), expected->getMeshCount());
+    ASSERT_EQ(actual->getJointGroupCount(), 0u);
+    for (std::uint16_t meshIndex = 0u; meshIndex < expected->getMeshCount(); ++meshIndex) {
+        ASSERT_TRUE(actual->getVertexPositionXs(meshIndex) == expected->getVertexPositionXs(meshIndex));
+        ASSERT_EQ(actual->getFaceCount(meshIndex), expected->getFaceCount(meshIndex));
+        ASSERT_EQ(actual->getBlendShapeTargetCount(meshIndex), 0u);
+    }
+}
@@ -0,0 +1,160 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "fixtures/TestDNA.h"
+
+#include "dna/stream/BinaryStreamReaderImpl.h"
+#include "trio/streams/PositionalReadable.h"
+
+#include <dna/BinaryStreamReader.h>
+#include <pma/ScopedPtr.h>
+#include <trio/streams/FileStream.h>
+#include <trio/streams/MemoryMappedFileStream.h>
+#include <trio/streams/MemoryStream.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace {
+
+class BinaryStreamReaderTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            networkBuffer = fixtures::makeTestDNA(fixtures::TestDNAConfig{}, dna::ByteOrder::Network);
+            nativeBuffer = fixtures::makeTestDNA(fixtures::TestDNAConfig{}, dna::ByteOrder::Native);
+            expected = fixtures::readTestDNA(networkBuffer);
+            ASSERT_TRUE(dna::Status::isOk());
+        }
+
+        void TearDown() override {
+            for (const auto& path : paths) {
+                std::remove(path.c_str());
+            }
+        }
+
+        std::string writeFile(const std::vector<char>& buffer, const char* name) {
+            paths.push_back(::testing::TempDir() + name);
+            std::ofstream file{paths.back(), std::ios::binary};
+            file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            return paths.back();
+        }
+
+        pma::ScopedPtr<dna::BinaryStreamReader> readWithThreads(trio::BoundedIOStream* stream, std::uint16_t threadCount) {
+            std::vector<std::uint16_t> lods(expected->getLODCount());
+            std::iota(lods.begin(), lods.end(), static_cast<std::uint16_t>(0u));
+            auto reader = pma::makeScoped<dna::BinaryStreamReader>(stream,
+                                                                   dna::DataLayer::All,
+                                                                   lods.data(),
+                                                                   static_cast<std::uint16_t>(lods.size()),
+                                                                   threadCount);
+            reader->read();
+            return reader;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+        static dna::DNA& loadedDNA(dna::BinaryStreamReader* reader) {
+            return static_cast<dna::BinaryStreamReaderImpl*>(reader)->getLoadedDNA();
+        }
+
+    protected:
+        std::vector<char> networkBuffer;
+        std::vector<char> nativeBuffer;
+        pma::ScopedPtr<dna::BinaryStreamReader> expected;
+        std::vector<std::string> paths;
+};
+
+}  // namespace
+
+TEST_F(BinaryStreamReaderTest, NativeByteOrderRoundTrip) {
+    auto reader = fixtures::readTestDNA(nativeBuffer);
+    ASSERT_TRUE(dna::Status::isOk());
+    fixtures::expectEqual(expected.get(), reader.get());
+}
+
+TEST_F(BinaryStreamReaderTest, NativeArraysAreBorrowedFromMappedStream) {
+    const auto path = writeFile(nativeBuffer, "native.dna");
+    auto stream = pma::makeScoped<trio::MemoryMappedFileStream>(path.c_str(), trio::AccessMode::Read);
+    auto reader = pma::makeScoped<dna::BinaryStreamReader>(stream.get(), dna::ReadMode::Borrow, dna::DataLayer::All, 0u, 1u);
+    reader->read();
+    ASSERT_TRUE(dna::Status::isOk());
+    fixtures::expectEqual(expected.get(), reader.get());
+
+    // Arrays are borrowed regardless of the alignment their storage requires
+    auto& dna = loadedDNA(reader.get());
+    for (const auto& jointGroup : dna.behavior.joints.jointGroups) {
+        ASSERT_TRUE(jointGroup.values.borrowed());
+        ASSERT_TRUE(jointGroup.outputIndices.borrowed());
+    }
+    for (const auto& mesh : dna.geometry.meshes) {
+        ASSERT_TRUE(mesh.positions.xs.borrowed());
+        ASSERT_TRUE(mesh.positions.zs.borrowed());
+        ASSERT_TRUE(mesh.textureCoordinates.us.borrowed());
+        ASSERT_TRUE(mesh.normals.ys.borrowed());
+        ASSERT_TRUE(mesh.layouts.positions.borrowed());
+        for (const auto& blendShapeTarget : mesh.blendShapeTargets) {
+            ASSERT_TRUE(blendShapeTarget.deltas.xs.borrowed());
+            ASSERT_TRUE(blendShapeTarget.vertexIndices.borrowed());
+        }
+    }
+}
+
+TEST_F(BinaryStreamReaderTest, NetworkArraysAreCopiedFromMappedStream) {
+    if (terse::nativeEndianness() == terse::Endianness::Network) {
+        GTEST_SKIP() << "Network byte order is the native byte order.";
+    }
+    const auto path = writeFile(networkBuffer, "network.dna");
+    auto stream = pma::makeScoped<trio::MemoryMappedFileStream>(path.c_str(), trio::AccessMode::Read);
+    auto reader = pma::makeScoped<dna::BinaryStreamReader>(stream.get(), dna::ReadMode::Borrow, dna::DataLayer::All, 0u, 1u);
+    reader->read();
+    ASSERT_TRUE(dna::Status::isOk());
+    fixtures::expectEqual(expected.get(), reader.get());
+    ASSERT_FALSE(loadedDNA(reader.get()).geometry.meshes[0].positions.xs.borrowed());
+}
+
+TEST_F(BinaryStreamReaderTest, MalformedStringTableIsReported) {
+    // Only native files store names as string tables
+    auto buffer = nativeBuffer;
+    const std::string name{"joint0"};
+    auto it = std::search(buffer.begin(), buffer.end(), name.c_str(), name.c_str() + name.size() + 1ul);
+    ASSERT_NE(it, buffer.end());
+    // Without its terminator, the name would run into the one after it
+    it[static_cast<std::ptrdiff_t>(name.size())] = 'x';
+    auto reader = fixtures::readTestDNA(buffer);
+    ASSERT_FALSE(dna::Status::isOk());
+    ASSERT_EQ(dna::Status::get().code, dna::BinaryStreamReader::InvalidDataError.code);
+}
+
+TEST_F(BinaryStreamReaderTest, MeshesAreLoadedByMultipleThreadsThroughPositionalReads) {
+    const auto path = writeFile(nativeBuffer, "positional.dna");
+    // Unbuffered file streams are read positionally where available
+    auto stream = pma::makeScoped<trio::FileStream>(path.c_str(), trio::AccessMode::Read, trio::OpenMode::Binary, 0ul);
+    auto reader = readWithThreads(stream.get(), 4u);
+    ASSERT_TRUE(dna::Status::isOk());
+    fixtures::expectEqual(expected.get(), reader.get());
+}
+
+TEST_F(BinaryStreamReaderTest, MeshesAreLoadedByMultipleThreadsFromMemoryStream) {
+    auto stream = pma::makeScoped<trio::MemoryStream>();
+    stream->open();
+    stream->write(nativeBuffer.data(), nativeBuffer.size());
+    stream->close();
+    ASSERT_NE(trio::PositionalReadable::find(stream.get()), nullptr);
+    auto reader = readWithThreads(stream.get(), 4u);
+    ASSERT_TRUE(dna::Status::isOk());
+    fixtures::expectEqual(expected.get(), reader.get());
+}
+
+TEST_F(BinaryStreamReaderTest, MeshesAreLoadedByMultipleThreadsFromStreamWithoutPositionalReads) {
+    const auto path = writeFile(networkBuffer, "serialized.dna");
+    auto stream = pma::makeScoped<trio::FileStream>(path.c_str(), trio::AccessMode::Read, trio::OpenMode::Binary);
+    ASSERT_EQ(trio::PositionalReadable::find(stream.get()), nullptr);
+    auto reader = readWithThreads(stream.get(), 4u);
+    ASSERT_TRUE(dna::Status::isOk());
+    fixtures::expectEqual(expected.get(), reader.get());
+}
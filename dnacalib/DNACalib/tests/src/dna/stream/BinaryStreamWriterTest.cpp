@@ -0,0 +1,54 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "fixtures/TestDNA.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+class BinaryStreamWriterTest : public ::testing::TestWithParam<dna::ByteOrder> {
+};
+
+}  // namespace
+
+TEST_P(BinaryStreamWriterTest, ParallelWriteMatchesSequentialWrite) {
+    fixtures::TestDNAConfig config;
+    config.meshCount = 7u;
+    const auto sequential = fixtures::makeTestDNA(config, GetParam(), 1u);
+    for (std::uint16_t threadCount : {2u, 3u, 8u}) {
+        ASSERT_EQ(fixtures::makeTestDNA(config, GetParam(), threadCount), sequential);
+    }
+}
+
+TEST_P(BinaryStreamWriterTest, WrittenDataIsReadBack) {
+    fixtures::TestDNAConfig config;
+    auto reader = fixtures::readTestDNA(fixtures::makeTestDNA(config, GetParam()));
+    ASSERT_TRUE(dna::Status::isOk());
+    ASSERT_EQ(reader->getMeshCount(), config.meshCount);
+    ASSERT_EQ(reader->getJointCount(), config.jointCount);
+    ASSERT_EQ(reader->getJointGroupCount(), config.jointGroupCount);
+    for (std::uint16_t meshIndex = 0u; meshIndex < config.meshCount; ++meshIndex) {
+        ASSERT_EQ(reader->getVertexPositionCount(meshIndex), config.vertexCount);
+        ASSERT_EQ(reader->getBlendShapeTargetCount(meshIndex), config.blendShapeCount);
+    }
+    // The byte order doesn't affect the data itself
+    auto network = fixtures::readTestDNA(fixtures::makeTestDNA(config, dna::ByteOrder::Network));
+    fixtures::expectEqual(network.get(), reader.get());
+}
+
+INSTANTIATE_TEST_SUITE_P(ByteOrders,
+                         BinaryStreamWriterTest,
+                         ::testing::Values(dna::ByteOrder::Network, dna::ByteOrder::Native));
+
+TEST(BinaryStreamWriterVersionTest, OnlyNativeFilesAreWrittenInTheNewFormatVersion) {
+    // The signature is followed by the generation and the version, both stored in network byte order
+    const auto version = [](const std::vector<char>& buffer) {
+            return static_cast<std::uint16_t>((static_cast<unsigned char>(buffer[5]) << 8u) |
+                                              static_cast<unsigned char>(buffer[6]));
+        };
+    ASSERT_EQ(version(fixtures::makeTestDNA(fixtures::TestDNAConfig{}, dna::ByteOrder::Network)), 1u);
+    ASSERT_EQ(version(fixtures::makeTestDNA(fixtures::TestDNAConfig{}, dna::ByteOrder::Native)), 2u);
+}
@@ -0,0 +1,85 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "fixtures/TestDNA.h"
+
+#include <dna/LazyBinaryStreamReader.h>
+#include <pma/ScopedPtr.h>
+#include <trio/streams/MemoryStream.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+class LazyBinaryStreamReaderTest : public ::testing::TestWithParam<dna::ByteOrder> {
+    protected:
+        void SetUp() override {
+            const auto buffer = fixtures::makeTestDNA(fixtures::TestDNAConfig{}, GetParam());
+            expected = fixtures::readTestDNA(buffer);
+            ASSERT_TRUE(dna::Status::isOk());
+
+            // The lazy reader loads from the stream until it's destroyed, so the stream must outlive it
+            stream = pma::makeScoped<trio::MemoryStream>();
+            stream->open();
+            stream->write(buffer.data(), buffer.size());
+            stream->close();
+        }
+
+        pma::ScopedPtr<dna::LazyBinaryStreamReader> read(std::uint16_t maxLOD = 0u) {
+            auto reader = pma::makeScoped<dna::LazyBinaryStreamReader>(stream.get(), maxLOD);
+            reader->read();
+            return reader;
+        }
+
+    protected:
+        pma::ScopedPtr<dna::BinaryStreamReader> expected;
+        pma::ScopedPtr<trio::MemoryStream> stream;
+};
+
+}  // namespace
+
+TEST_P(LazyBinaryStreamReaderTest, LoadsTheSameDataAsTheEagerReader) {
+    auto reader = read();
+    ASSERT_TRUE(dna::Status::isOk());
+    fixtures::expectEqual(expected.get(), reader.get());
+}
+
+TEST_P(LazyBinaryStreamReaderTest, LoadsOnlyTheMeshesThatAreAccessed) {
+    auto reader = read();
+    ASSERT_TRUE(dna::Status::isOk());
+    ASSERT_EQ(dna::getMemoryReport(reader.get()).geometry, 0ul);
+    ASSERT_EQ(dna::getMemoryReport(reader.get()).jointGroups, 0ul);
+
+    const auto xs = reader->getVertexPositionXs(1u);
+    ASSERT_TRUE(dna::Status::isOk());
+    ASSERT_TRUE(xs == expected->getVertexPositionXs(1u));
+    ASSERT_GT(dna::getMeshMemoryReport(reader.get(), 1u).positions, 0ul);
+    ASSERT_EQ(dna::getMeshMemoryReport(reader.get(), 0u).total(), 0ul);
+    ASSERT_EQ(dna::getMeshMemoryReport(reader.get(), 2u).total(), 0ul);
+}
+
+TEST_P(LazyBinaryStreamReaderTest, UnloadedLayersAreLoadedAgainOnAccess) {
+    auto reader = read();
+    ASSERT_EQ(reader->getJointGroupCount(), expected->getJointGroupCount());
+    reader->unload(dna::DataLayer::Behavior);
+    ASSERT_EQ(dna::getMemoryReport(reader.get()).jointGroups, 0ul);
+    ASSERT_TRUE(reader->getJointGroupValues(0u) == expected->getJointGroupValues(0u));
+    ASSERT_TRUE(dna::Status::isOk());
+}
+
+TEST_P(LazyBinaryStreamReaderTest, LoadsTheSameLODsAsTheEagerReader) {
+    auto eager = pma::makeScoped<dna::BinaryStreamReader>(stream.get(), dna::DataLayer::All, 1u);
+    eager->read();
+    ASSERT_TRUE(dna::Status::isOk());
+
+    auto reader = read(1u);
+    ASSERT_TRUE(dna::Status::isOk());
+    ASSERT_EQ(reader->getLODCount(), 1u);
+    fixtures::expectEqual(eager.get(), reader.get());
+}
+
+INSTANTIATE_TEST_SUITE_P(ByteOrders,
+                         LazyBinaryStreamReaderTest,
+                         ::testing::Values(dna::ByteOrder::Network, dna::ByteOrder::Native));
@@ -0,0 +1,215 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "fixtures/TestDNA.h"
+
+#include "dnacalib/dna/DNACalibDNAReaderImpl.h"
+
+#include <dnacalib/DNACalib.h>
+#include <pma/resources/DefaultMemoryResource.h>
+#include <pma/resources/TrackingMemoryResource.h>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace {
+
+constexpr std::uint16_t meshIndex = 0u;
+
+// Hands out the most recently freed block of the same size first, so new objects take the addresses of destroyed ones
+class RecyclingMemoryResource : public pma::MemoryResource {
+    public:
+        explicit RecyclingMemoryResource(pma::MemoryResource* upstream_) : upstream{upstream_} {
+        }
+
+        ~RecyclingMemoryResource() override {
+            for (const auto& block : freed) {
+                upstream->deallocate(block.ptr, block.size, block.alignment);
+            }
+        }
+
+        void* allocate(std::size_t size, std::size_t alignment) override {
+            for (auto it = freed.rbegin(); it != freed.rend(); ++it) {
+                if ((it->size == size) && (it->alignment == alignment)) {
+                    void* ptr = it->ptr;
+                    freed.erase(std::next(it).base());
+                    return ptr;
+                }
+            }
+            return upstream->allocate(size, alignment);
+        }
+
+        void deallocate(void* ptr, std::size_t size, std::size_t alignment) override {
+            freed.push_back(Block{ptr, size, alignment});
+        }
+
+    private:
+        struct Block {
+            void* ptr;
+            std::size_t size;
+            std::size_t alignment;
+        };
+
+        pma::MemoryResource* upstream;
+        std::vector<Block> freed;
+};
+
+class CommandSequenceTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            source = fixtures::readTestDNA(fixtures::makeTestDNA(), &upstream);
+            ASSERT_TRUE(dna::Status::isOk());
+            reader = pma::makeScoped<dnac::DNACalibDNAReader>(source.get(), &memRes);
+            expected = pma::makeScoped<dnac::DNACalibDNAReader>(source.get(), &upstream);
+
+            deltas.assign(reader->getVertexPositionCount(meshIndex), dnac::Vector3{1.0f, 1.0f, 1.0f});
+            translate = pma::makeScoped<dnac::SetVertexPositionsCommand>(meshIndex, view(deltas), dnac::VectorOperation::Add);
+            masks.assign(deltas.size() + 1ul, 1.0f);
+            // Fails, as the number of masks differs from the number of positions
+            fail = pma::makeScoped<dnac::SetVertexPositionsCommand>(meshIndex,
+                                                                   view(deltas),
+                                                                   dnac::ConstArrayView<float>{masks.data(), masks.size()},
+                                                                   dnac::VectorOperation::Add);
+            scale = pma::makeScoped<dnac::ScaleCommand>(2.0f, dnac::Vector3{0.0f, 0.0f, 0.0f});
+        }
+
+        static dnac::ConstArrayView<dnac::Vector3> view(const std::vector<dnac::Vector3>& values) {
+            return dnac::ConstArrayView<dnac::Vector3>{values.data(), values.size()};
+        }
+
+        std::size_t usedBytes() const {
+            return memRes.getStatistics().usedBytes;
+        }
+
+    protected:
+        pma::DefaultMemoryResource upstream;
+        pma::TrackingMemoryResource memRes{&upstream};
+        pma::ScopedPtr<dna::BinaryStreamReader> source;
+        pma::ScopedPtr<dnac::DNACalibDNAReader> reader;
+        pma::ScopedPtr<dnac::DNACalibDNAReader> expected;
+        std::vector<dnac::Vector3> deltas;
+        std::vector<float> masks;
+        pma::ScopedPtr<dnac::SetVertexPositionsCommand> translate;
+        pma::ScopedPtr<dnac::SetVertexPositionsCommand> fail;
+        pma::ScopedPtr<dnac::ScaleCommand> scale;
+};
+
+}  // namespace
+
+TEST_F(CommandSequenceTest, FailingCommandRollsBackTheWholeSequence) {
+    dnac::CommandSequence sequence;
+    sequence.setTransactional(true);
+    sequence.add(translate.get(), scale.get(), fail.get());
+    sequence.run(reader.get());
+    ASSERT_FALSE(dnac::Status::isOk());
+    ASSERT_EQ(dnac::Status::get(), dnac::SetVertexPositionsCommand::PositionsMasksCountMismatch);
+    fixtures::expectEqual(expected.get(), reader.get());
+    // The state was already restored
+    ASSERT_FALSE(sequence.rollback());
+}
+
+TEST_F(CommandSequenceTest, FailingCommandIsNotRolledBackOutsideOfTransactionalMode) {
+    dnac::CommandSequence sequence;
+    sequence.add(translate.get(), fail.get());
+    sequence.run(reader.get());
+    ASSERT_FALSE(dnac::Status::isOk());
+    ASSERT_EQ(reader->getVertexPositionXs(0u)[0], expected->getVertexPositionXs(0u)[0] + 1.0f);
+    ASSERT_FALSE(sequence.rollback());
+}
+
+TEST_F(CommandSequenceTest, RollbackRestoresTheStateFromBeforeTheLastRun) {
+    dnac::CommandSequence sequence;
+    sequence.setTransactional(true);
+    sequence.add(translate.get());
+    sequence.run(reader.get());
+    sequence.commit();
+    auto committed = pma::makeScoped<dnac::DNACalibDNAReader>(reader.get());
+
+    sequence.add(scale.get());
+    sequence.run(reader.get());
+    ASSERT_TRUE(dnac::Status::isOk());
+    ASSERT_TRUE(sequence.rollback());
+    fixtures::expectEqual(committed.get(), reader.get());
+    ASSERT_FALSE(sequence.rollback());
+}
+
+TEST_F(CommandSequenceTest, CommitKeepsTheChanges) {
+    dnac::CommandSequence sequence;
+    sequence.setTransactional(true);
+    sequence.add(translate.get());
+    sequence.run(reader.get());
+    sequence.commit();
+    ASSERT_FALSE(sequence.rollback());
+    ASSERT_EQ(reader->getVertexPositionXs(0u)[0], expected->getVertexPositionXs(0u)[0] + 1.0f);
+}
+
+TEST_F(CommandSequenceTest, CommitReleasesTheStateFromBeforeTheRun) {
+    dnac::CommandSequence sequence;
+    sequence.add(translate.get(), scale.get());
+    sequence.setTransactional(true);
+    // The first run also allocates what the commands themselves keep around
+    sequence.run(reader.get());
+    sequence.commit();
+    const auto baseline = usedBytes();
+    for (int i = 0; i < 3; ++i) {
+        sequence.run(reader.get());
+        ASSERT_GT(usedBytes(), baseline);
+        sequence.commit();
+        ASSERT_EQ(usedBytes(), baseline);
+    }
+}
+
+TEST_F(CommandSequenceTest, CommittedDNATakesAsMuchMemoryAsWithoutTransactionalMode) {
+    pma::TrackingMemoryResource plainMemRes{&upstream};
+    auto plain = pma::makeScoped<dnac::DNACalibDNAReader>(source.get(), &plainMemRes);
+    dnac::CommandSequence plainSequence;
+    plainSequence.add(translate.get(), scale.get());
+    plainSequence.run(plain.get());
+
+    dnac::CommandSequence sequence;
+    sequence.add(translate.get(), scale.get());
+    sequence.setTransactional(true);
+    sequence.run(reader.get());
+    sequence.commit();
+
+    fixtures::expectEqual(plain.get(), reader.get());
+    ASSERT_EQ(usedBytes(), plainMemRes.getStatistics().usedBytes);
+}
+
+TEST_F(CommandSequenceTest, RunningAnotherDNADiscardsTheStateOfTheLastOne) {
+    dnac::CommandSequence sequence;
+    sequence.setTransactional(true);
+    sequence.add(translate.get());
+    sequence.run(reader.get());
+    // The DNA passed to the last run is not accessed anymore
+    reader.reset();
+    sequence.run(expected.get());
+    ASSERT_TRUE(sequence.rollback());
+    auto original = pma::makeScoped<dnac::DNACalibDNAReader>(source.get());
+    fixtures::expectEqual(original.get(), expected.get());
+}
+
+TEST_F(CommandSequenceTest, DNAAllocatedAtTheAddressOfADestroyedOneIsNotTakenForIt) {
+    RecyclingMemoryResource recycling{&upstream};
+    auto first = pma::makeScoped<dnac::DNACalibDNAReader>(source.get(), &recycling);
+    dnac::CommandSequence sequence;
+    sequence.setTransactional(true);
+    sequence.add(translate.get());
+    sequence.run(first.get());
+    const void* address = first.get();
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    const auto identity = static_cast<dnac::DNACalibDNAReaderImpl*>(first.get())->getIdentity();
+    first.reset();
+
+    auto second = pma::makeScoped<dnac::DNACalibDNAReader>(source.get(), &recycling);
+    if (second.get() != address) {
+        GTEST_SKIP() << "The DNA was not allocated at the address of the destroyed one.";
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    ASSERT_NE(static_cast<dnac::DNACalibDNAReaderImpl*>(second.get())->getIdentity(), identity);
+    sequence.run(second.get());
+    ASSERT_TRUE(sequence.rollback());
+    fixtures::expectEqual(expected.get(), second.get());
+}
@@ -0,0 +1,111 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "fixtures/TestDNA.h"
+
+#include <dnacalib/DNACalib.h>
+#include <pma/resources/DefaultMemoryResource.h>
+#include <pma/resources/TrackingMemoryResource.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace {
+
+class DNACalibDNAReaderTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            auto source = fixtures::readTestDNA(fixtures::makeTestDNA(), &memRes);
+            ASSERT_TRUE(dna::Status::isOk());
+            reader = pma::makeScoped<dnac::DNACalibDNAReader>(source.get(), &memRes);
+        }
+
+        std::size_t usedBytes() const {
+            return memRes.getStatistics().usedBytes;
+        }
+
+        pma::ScopedPtr<dnac::DNACalibDNAReader> clone() {
+            return pma::ScopedPtr<dnac::DNACalibDNAReader>{dnac::DNACalibDNAReader::clone(reader.get())};
+        }
+
+        // Moves all vertices of the given mesh
+        static void translate(dnac::DNACalibDNAReader* output, std::uint16_t meshIndex, float offset) {
+            std::vector<dnac::Vector3> deltas(output->getVertexPositionCount(meshIndex), dnac::Vector3{offset, offset, offset});
+            dnac::SetVertexPositionsCommand command{meshIndex,
+                                                    dnac::ConstArrayView<dnac::Vector3>{deltas.data(), deltas.size()},
+                                                    dnac::VectorOperation::Add};
+            command.run(output);
+        }
+
+        static void translateAll(dnac::DNACalibDNAReader* output, float offset) {
+            for (std::uint16_t meshIndex = 0u; meshIndex < output->getMeshCount(); ++meshIndex) {
+                translate(output, meshIndex, offset);
+            }
+        }
+
+    protected:
+        pma::DefaultMemoryResource upstream;
+        pma::TrackingMemoryResource memRes{&upstream};
+        pma::ScopedPtr<dnac::DNACalibDNAReader> reader;
+};
+
+}  // namespace
+
+TEST_F(DNACalibDNAReaderTest, CloneHoldsTheSameData) {
+    auto copy = clone();
+    fixtures::expectEqual(reader.get(), copy.get());
+}
+
+TEST_F(DNACalibDNAReaderTest, ClonesAreIndependent) {
+    auto expected = pma::makeScoped<dnac::DNACalibDNAReader>(reader.get());
+    auto copy = clone();
+
+    translate(copy.get(), 0u, 1.0f);
+    fixtures::expectEqual(expected.get(), reader.get());
+    ASSERT_EQ(copy->getVertexPositionXs(0u)[0], reader->getVertexPositionXs(0u)[0] + 1.0f);
+    // Arrays that were not modified are still shared
+    ASSERT_EQ(copy->getVertexPositionXs(1u).data(), reader->getVertexPositionXs(1u).data());
+
+    translate(reader.get(), 1u, 2.0f);
+    ASSERT_EQ(copy->getVertexPositionXs(1u)[0], expected->getVertexPositionXs(1u)[0]);
+
+    // Clones outlive the reader they were cloned from
+    copy = clone();
+    reader.reset();
+    ASSERT_EQ(copy->getVertexPositionXs(0u)[0], expected->getVertexPositionXs(0u)[0]);
+    ASSERT_EQ(copy->getVertexPositionXs(1u)[0], expected->getVertexPositionXs(1u)[0] + 2.0f);
+}
+
+TEST_F(DNACalibDNAReaderTest, CloneSharesUnmodifiedArrays) {
+    const auto baseline = usedBytes();
+    auto copy = clone();
+    const auto cloneBytes = usedBytes() - baseline;
+    translateAll(copy.get(), 1.0f);
+    // Only the modified arrays are copied
+    ASSERT_GT(usedBytes() - baseline, cloneBytes);
+}
+
+TEST_F(DNACalibDNAReaderTest, DestroyingAModifiedCloneReleasesItsMemory) {
+    // The first clone moves the arrays of the original into shared storage, which the original keeps using
+    clone();
+    const auto baseline = usedBytes();
+    for (int i = 0; i < 3; ++i) {
+        auto copy = clone();
+        translateAll(copy.get(), 1.0f);
+        copy.reset();
+        ASSERT_EQ(usedBytes(), baseline);
+    }
+}
+
+TEST_F(DNACalibDNAReaderTest, ReplacedArraysAreReleasedByTheLastReaderUsingThem) {
+    clone();
+    const auto baseline = usedBytes();
+    auto copy = clone();
+    translateAll(copy.get(), 1.0f);
+    translateAll(reader.get(), 1.0f);
+    // Neither reader uses the storage that was shared anymore, and both hold arrays of their own
+    const auto bothModified = usedBytes();
+    copy.reset();
+    ASSERT_LT(usedBytes(), bothModified);
+    ASSERT_LE(usedBytes(), baseline);
+}
@@ -0,0 +1,315 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "fixtures/TestDNA.h"
+
+#include <dna/BinaryStreamWriter.h>
+#include <pma/ScopedPtr.h>
+#include <trio/streams/MemoryStream.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <numeric>
+#include <string>
+
+namespace fixtures {
+
+namespace {
+
+constexpr std::uint16_t rawControlCount = 4u;
+constexpr std::uint16_t attributesPerJoint = 9u;
+
+float valueAt(std::uint32_t seed, std::uint32_t index) {
+    return static_cast<float>((seed * 131u + index * 7u) % 1000u) * 0.01f;
+}
+
+template<typename T>
+std::vector<T> iota(std::size_t count, T first = {}) {
+    std::vector<T> values(count);
+    std::iota(values.begin(), values.end(), first);
+    return values;
+}
+
+template<typename T, typename U>
+void expectEqualArrays(const dna::ConstArrayView<T>& expected, const dna::ConstArrayView<U>& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (std::size_t i = 0ul; i < expected.size(); ++i) {
+        ASSERT_EQ(expected[i], actual[i]);
+    }
+}
+
+void expectEqualStrings(const dna::StringView& expected, const dna::StringView& actual) {
+    ASSERT_EQ(std::string(expected.data(), expected.size()), std::string(actual.data(), actual.size()));
+}
+
+void writeDefinition(dna::Writer* writer, const TestDNAConfig& config) {
+    for (std::uint16_t i = 0u; i < rawControlCount; ++i) {
+        writer->setGUIControlName(i, ("gui" + std::to_string(i)).c_str());
+        writer->setRawControlName(i, ("raw" + std::to_string(i)).c_str());
+    }
+    std::vector<std::uint16_t> hierarchy(config.jointCount);
+    std::vector<dna::Vector3> translations(config.jointCount);
+    std::vector<dna::Vector3> rotations(config.jointCount);
+    for (std::uint16_t i = 0u; i < config.jointCount; ++i) {
+        writer->setJointName(i, ("joint" + std::to_string(i)).c_str());
+        hierarchy[i] = static_cast<std::uint16_t>(i == 0u ? 0u : i - 1u);
+        translations[i] = {valueAt(1u, i), valueAt(2u, i), valueAt(3u, i)};
+        rotations[i] = {valueAt(4u, i), valueAt(5u, i), valueAt(6u, i)};
+    }
+    writer->setJointHierarchy(hierarchy.data(), config.jointCount);
+    writer->setNeutralJointTranslations(translations.data(), config.jointCount);
+    writer->setNeutralJointRotations(rotations.data(), config.jointCount);
+    const auto jointIndices = iota<std::uint16_t>(config.jointCount);
+    writer->setJointIndices(0u, jointIndices.data(), config.jointCount);
+    writer->setLODJointMapping(0u, 0u);
+    writer->setLODJointMapping(1u, 0u);
+
+    for (std::uint16_t i = 0u; i < config.blendShapeCount; ++i) {
+        writer->setBlendShapeChannelName(i, ("blendShape" + std::to_string(i)).c_str());
+    }
+    const auto blendShapeChannelIndices = iota<std::uint16_t>(config.blendShapeCount);
+    writer->setBlendShapeChannelIndices(0u, blendShapeChannelIndices.data(), config.blendShapeCount);
+    writer->setLODBlendShapeChannelMapping(0u, 0u);
+    writer->setLODBlendShapeChannelMapping(1u, 0u);
+
+    writer->setAnimatedMapName(0u, "animatedMap0");
+    const std::uint16_t animatedMapIndices[] = {0u};
+    writer->setAnimatedMapIndices(0u, animatedMapIndices, 1u);
+    writer->setLODAnimatedMapMapping(0u, 0u);
+    writer->setLODAnimatedMapMapping(1u, 0u);
+
+    // All meshes are used by the first LOD, while the second one uses only the first mesh
+    for (std::uint16_t i = 0u; i < config.meshCount; ++i) {
+        writer->setMeshName(i, ("mesh" + std::to_string(i)).c_str());
+    }
+    const auto meshIndices = iota<std::uint16_t>(config.meshCount);
+    writer->setMeshIndices(0u, meshIndices.data(), config.meshCount);
+    writer->setMeshIndices(1u, meshIndices.data(), 1u);
+    writer->setLODMeshMapping(0u, 0u);
+    writer->setLODMeshMapping(1u, 1u);
+
+    std::uint32_t mappingIndex = 0u;
+    for (std::uint16_t meshIndex = 0u; meshIndex < config.meshCount; ++meshIndex) {
+        for (std::uint16_t i = 0u; i < config.blendShapeCount; ++i) {
+            writer->setMeshBlendShapeChannelMapping(mappingIndex++, meshIndex, i);
+        }
+    }
+}
+
+void writeBehavior(dna::Writer* writer, const TestDNAConfig& config) {
+    const auto controlIndices = iota<std::uint16_t>(rawControlCount);
+    std::vector<float> ones(rawControlCount, 1.0f);
+    std::vector<float> zeros(rawControlCount, 0.0f);
+    writer->setGUIToRawInputIndices(controlIndices.data(), rawControlCount);
+    writer->setGUIToRawOutputIndices(controlIndices.data(), rawControlCount);
+    writer->setGUIToRawFromValues(zeros.data(), rawControlCount);
+    writer->setGUIToRawToValues(ones.data(), rawControlCount);
+    writer->setGUIToRawSlopeValues(ones.data(), rawControlCount);
+    writer->setGUIToRawCutValues(zeros.data(), rawControlCount);
+
+    writer->setJointRowCount(static_cast<std::uint16_t>(config.jointCount * attributesPerJoint));
+    writer->setJointColumnCount(rawControlCount);
+    // Joints are distributed across joint groups in a round-robin fashion
+    for (std::uint16_t groupIndex = 0u; groupIndex < config.jointGroupCount; ++groupIndex) {
+        std::vector<std::uint16_t> jointIndices;
+        std::vector<std::uint16_t> outputIndices;
+        for (std::uint16_t jointIndex = groupIndex; jointIndex < config.jointCount; jointIndex += config.jointGroupCount) {
+            jointIndices.push_back(jointIndex);
+            for (std::uint16_t attribute = 0u; attribute < attributesPerJoint; ++attribute) {
+                outputIndices.push_back(static_cast<std::uint16_t>(jointIndex * attributesPerJoint + attribute));
+            }
+        }
+        const auto outputCount = static_cast<std::uint16_t>(outputIndices.size());
+        const std::uint16_t lods[] = {outputCount, static_cast<std::uint16_t>(outputCount / 2u)};
+        std::vector<float> values(static_cast<std::size_t>(outputCount) * rawControlCount);
+        for (std::size_t i = 0ul; i < values.size(); ++i) {
+            values[i] = valueAt(groupIndex, static_cast<std::uint32_t>(i));
+        }
+        writer->setJointGroupJointIndices(groupIndex, jointIndices.data(), static_cast<std::uint16_t>(jointIndices.size()));
+        writer->setJointGroupOutputIndices(groupIndex, outputIndices.data(), outputCount);
+        writer->setJointGroupInputIndices(groupIndex, controlIndices.data(), rawControlCount);
+        writer->setJointGroupLODs(groupIndex, lods, 2u);
+        writer->setJointGroupValues(groupIndex, values.data(), static_cast<std::uint32_t>(values.size()));
+    }
+
+    const auto blendShapeIndices = iota<std::uint16_t>(config.blendShapeCount);
+    std::vector<std::uint16_t> blendShapeInputIndices(config.blendShapeCount);
+    for (std::uint16_t i = 0u; i < config.blendShapeCount; ++i) {
+        blendShapeInputIndices[i] = static_cast<std::uint16_t>(i % rawControlCount);
+    }
+    const std::uint16_t blendShapeLODs[] = {config.blendShapeCount, config.blendShapeCount};
+    writer->setBlendShapeChannelLODs(blendShapeLODs, 2u);
+    writer->setBlendShapeChannelInputIndices(blendShapeInputIndices.data(), config.blendShapeCount);
+    writer->setBlendShapeChannelOutputIndices(blendShapeIndices.data(), config.blendShapeCount);
+
+    const std::uint16_t animatedMapLODs[] = {1u, 1u};
+    const std::uint16_t animatedMapIndices[] = {0u};
+    const float zero[] = {0.0f};
+    const float one[] = {1.0f};
+    writer->setAnimatedMapLODs(animatedMapLODs, 2u);
+    writer->setAnimatedMapInputIndices(animatedMapIndices, 1u);
+    writer->setAnimatedMapOutputIndices(animatedMapIndices, 1u);
+    writer->setAnimatedMapFromValues(zero, 1u);
+    writer->setAnimatedMapToValues(one, 1u);
+    writer->setAnimatedMapSlopeValues(one, 1u);
+    writer->setAnimatedMapCutValues(zero, 1u);
+}
+
+void writeGeometry(dna::Writer* writer, const TestDNAConfig& config) {
+    const std::uint32_t vertexCount = config.vertexCount;
+    const std::uint32_t faceCount = vertexCount / 4u;
+    for (std::uint16_t meshIndex = 0u; meshIndex < config.meshCount; ++meshIndex) {
+        std::vector<dna::Position> positions(vertexCount);
+        std::vector<dna::TextureCoordinate> textureCoordinates(vertexCount);
+        std::vector<dna::Normal> normals(vertexCount);
+        std::vector<dna::VertexLayout> layouts(vertexCount);
+        for (std::uint32_t i = 0u; i < vertexCount; ++i) {
+            positions[i] = {valueAt(meshIndex, i), valueAt(meshIndex + 1u, i), valueAt(meshIndex + 2u, i)};
+            textureCoordinates[i] = {valueAt(meshIndex + 3u, i), valueAt(meshIndex + 4u, i)};
+            normals[i] = {0.0f, 1.0f, valueAt(meshIndex + 5u, i)};
+            layouts[i] = {i, i, i};
+        }
+        writer->setVertexPositions(meshIndex, positions.data(), vertexCount);
+        writer->setVertexTextureCoordinates(meshIndex, textureCoordinates.data(), vertexCount);
+        writer->setVertexNormals(meshIndex, normals.data(), vertexCount);
+        writer->setVertexLayouts(meshIndex, layouts.data(), vertexCount);
+        for (std::uint32_t faceIndex = 0u; faceIndex < faceCount; ++faceIndex) {
+            const std::uint32_t face[] = {faceIndex * 4u, faceIndex * 4u + 1u, faceIndex * 4u + 2u, faceIndex * 4u + 3u};
+            writer->setFaceVertexLayoutIndices(meshIndex, faceIndex, face, 4u);
+        }
+
+        writer->setMaximumInfluencePerVertex(meshIndex, 2u);
+        for (std::uint32_t i = 0u; i < vertexCount; ++i) {
+            const float weights[] = {0.25f, 0.75f};
+            const std::uint16_t joints[] = {
+                static_cast<std::uint16_t>(i % config.jointCount),
+                static_cast<std::uint16_t>((i + 1u) % config.jointCount)
+            };
+            writer->setSkinWeightsValues(meshIndex, i, weights, 2u);
+            writer->setSkinWeightsJointIndices(meshIndex, i, joints, 2u);
+        }
+
+        // Each blend shape target moves a different subset of vertices
+        for (std::uint16_t targetIndex = 0u; targetIndex < config.blendShapeCount; ++targetIndex) {
+            std::vector<dna::Delta> deltas;
+            std::vector<std::uint32_t> vertexIndices;
+            for (std::uint32_t i = targetIndex; i < vertexCount; i += 2u) {
+                deltas.push_back({valueAt(targetIndex, i), valueAt(targetIndex + 1u, i), valueAt(targetIndex + 2u, i)});
+                vertexIndices.push_back(i);
+            }
+            const auto deltaCount = static_cast<std::uint32_t>(deltas.size());
+            writer->setBlendShapeChannelIndex(meshIndex, targetIndex, targetIndex);
+            writer->setBlendShapeTargetDeltas(meshIndex, targetIndex, deltas.data(), deltaCount);
+            writer->setBlendShapeTargetVertexIndices(meshIndex, targetIndex, vertexIndices.data(), deltaCount);
+        }
+    }
+}
+
+}  // namespace
+
+void writeTestDNA(dna::Writer* writer, const TestDNAConfig& config) {
+    writer->setName("test");
+    writer->setArchetype(dna::Archetype::other);
+    writer->setGender(dna::Gender::other);
+    writer->setAge(42u);
+    writer->setMetaData("key", "value");
+    writer->setTranslationUnit(dna::TranslationUnit::cm);
+    writer->setRotationUnit(dna::RotationUnit::degrees);
+    writer->setCoordinateSystem({dna::Direction::right, dna::Direction::up, dna::Direction::front});
+    writer->setLODCount(2u);
+    writer->setDBMaxLOD(1u);
+    writer->setDBComplexity("complexity");
+    writer->setDBName("db");
+
+    writeDefinition(writer, config);
+    writeBehavior(writer, config);
+    writeGeometry(writer, config);
+}
+
+std::vector<char> makeTestDNA(const TestDNAConfig& config, dna::ByteOrder byteOrder, std::uint16_t threadCount) {
+    auto stream = pma::makeScoped<trio::MemoryStream>();
+    auto writer = pma::makeScoped<dna::BinaryStreamWriter>(stream.get(), byteOrder, threadCount);
+    writeTestDNA(writer.get(), config);
+    writer->write();
+
+    std::vector<char> buffer(stream->size());
+    stream->open();
+    stream->seek(0ul);
+    stream->read(buffer.data(), buffer.size());
+    stream->close();
+    return buffer;
+}
+
+pma::ScopedPtr<dna::BinaryStreamReader> readTestDNA(const std::vector<char>& buffer, pma::MemoryResource* memRes) {
+    auto stream = pma::makeScoped<trio::MemoryStream>();
+    stream->open();
+    stream->write(buffer.data(), buffer.size());
+    stream->close();
+
+    auto reader = pma::makeScoped<dna::BinaryStreamReader>(stream.get(), dna::DataLayer::All, 0u, memRes);
+    reader->read();
+    return reader;
+}
+
+void expectEqual(const dna::Reader* expected, const dna::Reader* actual) {
+    expectEqualStrings(expected->getName(), actual->getName());
+    ASSERT_EQ(expected->getLODCount(), actual->getLODCount());
+    ASSERT_EQ(expected->getDBMaxLOD(), actual->getDBMaxLOD());
+
+    ASSERT_EQ(expected->getJointCount(), actual->getJointCount());
+    for (std::uint16_t i = 0u; i < expected->getJointCount(); ++i) {
+        expectEqualStrings(expected->getJointName(i), actual->getJointName(i));
+        ASSERT_EQ(expected->getJointParentIndex(i), actual->getJointParentIndex(i));
+    }
+    expectEqualArrays(expected->getNeutralJointTranslationXs(), actual->getNeutralJointTranslationXs());
+    expectEqualArrays(expected->getNeutralJointRotationZs(), actual->getNeutralJointRotationZs());
+    ASSERT_EQ(expected->getBlendShapeChannelCount(), actual->getBlendShapeChannelCount());
+    for (std::uint16_t lod = 0u; lod < expected->getLODCount(); ++lod) {
+        expectEqualArrays(expected->getMeshIndicesForLOD(lod), actual->getMeshIndicesForLOD(lod));
+        expectEqualArrays(expected->getJointIndicesForLOD(lod), actual->getJointIndicesForLOD(lod));
+    }
+
+    ASSERT_EQ(expected->getJointGroupCount(), actual->getJointGroupCount());
+    for (std::uint16_t i = 0u; i < expected->getJointGroupCount(); ++i) {
+        expectEqualArrays(expected->getJointGroupLODs(i), actual->getJointGroupLODs(i));
+        expectEqualArrays(expected->getJointGroupOutputIndices(i), actual->getJointGroupOutputIndices(i));
+        expectEqualArrays(expected->getJointGroupValues(i), actual->getJointGroupValues(i));
+    }
+    expectEqualArrays(expected->getBlendShapeChannelOutputIndices(), actual->getBlendShapeChannelOutputIndices());
+
+    ASSERT_EQ(expected->getMeshCount(), actual->getMeshCount());
+    for (std::uint16_t meshIndex = 0u; meshIndex < expected->getMeshCount(); ++meshIndex) {
+        expectEqualStrings(expected->getMeshName(meshIndex), actual->getMeshName(meshIndex));
+        expectEqualArrays(expected->getVertexPositionXs(meshIndex), actual->getVertexPositionXs(meshIndex));
+        expectEqualArrays(expected->getVertexPositionYs(meshIndex), actual->getVertexPositionYs(meshIndex));
+        expectEqualArrays(expected->getVertexPositionZs(meshIndex), actual->getVertexPositionZs(meshIndex));
+        expectEqualArrays(expected->getVertexTextureCoordinateUs(meshIndex), actual->getVertexTextureCoordinateUs(meshIndex));
+        expectEqualArrays(expected->getVertexNormalZs(meshIndex), actual->getVertexNormalZs(meshIndex));
+        expectEqualArrays(expected->getVertexLayoutPositionIndices(meshIndex),
+                          actual->getVertexLayoutPositionIndices(meshIndex));
+        ASSERT_EQ(expected->getFaceCount(meshIndex), actual->getFaceCount(meshIndex));
+        for (std::uint32_t faceIndex = 0u; faceIndex < expected->getFaceCount(meshIndex); ++faceIndex) {
+            expectEqualArrays(expected->getFaceVertexLayoutIndices(meshIndex, faceIndex),
+                              actual->getFaceVertexLayoutIndices(meshIndex, faceIndex));
+        }
+        ASSERT_EQ(expected->getSkinWeightsCount(meshIndex), actual->getSkinWeightsCount(meshIndex));
+        for (std::uint32_t i = 0u; i < expected->getSkinWeightsCount(meshIndex); ++i) {
+            expectEqualArrays(expected->getSkinWeightsValues(meshIndex, i), actual->getSkinWeightsValues(meshIndex, i));
+            expectEqualArrays(expected->getSkinWeightsJointIndices(meshIndex, i),
+                              actual->getSkinWeightsJointIndices(meshIndex, i));
+        }
+        ASSERT_EQ(expected->getBlendShapeTargetCount(meshIndex), actual->getBlendShapeTargetCount(meshIndex));
+        for (std::uint16_t targetIndex = 0u; targetIndex < expected->getBlendShapeTargetCount(meshIndex); ++targetIndex) {
+            ASSERT_EQ(expected->getBlendShapeChannelIndex(meshIndex, targetIndex),
+                      actual->getBlendShapeChannelIndex(meshIndex, targetIndex));
+            expectEqualArrays(expected->getBlendShapeTargetDeltaXs(meshIndex, targetIndex),
+                              actual->getBlendShapeTargetDeltaXs(meshIndex, targetIndex));
+            expectEqualArrays(expected->getBlendShapeTargetDeltaZs(meshIndex, targetIndex),
+                              actual->getBlendShapeTargetDeltaZs(meshIndex, targetIndex));
+            expectEqualArrays(expected->getBlendShapeTargetVertexIndices(meshIndex, targetIndex),
+                              actual->getBlendShapeTargetVertexIndices(meshIndex, targetIndex));
+        }
+    }
+}
+
+}  // namespace fixtures
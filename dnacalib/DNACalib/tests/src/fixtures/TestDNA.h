@@ -0,0 +1,41 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include <dna/BinaryStreamReader.h>
+#include <dna/ByteOrder.h>
+#include <dna/Reader.h>
+#include <dna/Writer.h>
+#include <pma/MemoryResource.h>
+#include <pma/ScopedPtr.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fixtures {
+
+// Shape of the generated DNA, with all layers populated, spread across two LODs
+struct TestDNAConfig {
+    std::uint16_t meshCount = 3u;
+    std::uint32_t vertexCount = 256u;
+    std::uint16_t blendShapeCount = 4u;
+    std::uint16_t jointCount = 6u;
+    std::uint16_t jointGroupCount = 2u;
+};
+
+// Populates the given writer with deterministic data of the given shape
+void writeTestDNA(dna::Writer* writer, const TestDNAConfig& config = TestDNAConfig{});
+
+// Serializes the test DNA into a binary buffer, using the given number of threads
+std::vector<char> makeTestDNA(const TestDNAConfig& config = TestDNAConfig{},
+                              dna::ByteOrder byteOrder = dna::ByteOrder::Network,
+                              std::uint16_t threadCount = 1u);
+
+// Reads all layers of a serialized DNA eagerly
+pma::ScopedPtr<dna::BinaryStreamReader> readTestDNA(const std::vector<char>& buffer, pma::MemoryResource* memRes = nullptr);
+
+// Asserts (through gtest) that both readers hold the same data
+void expectEqual(const dna::Reader* expected, const dna::Reader* actual);
+
+}  // namespace fixtures
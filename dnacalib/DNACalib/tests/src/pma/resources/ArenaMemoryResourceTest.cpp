@@ -0,0 +1,68 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include <pma/resources/ArenaMemoryResource.h>
+#include <pma/resources/DefaultMemoryResource.h>
+#include <pma/resources/TrackingMemoryResource.h>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+constexpr std::size_t regionSize = 1024ul;
+
+class ArenaMemoryResourceTest : public ::testing::Test {
+    protected:
+        pma::DefaultMemoryResource defaultMemRes;
+        pma::TrackingMemoryResource upstream{&defaultMemRes};
+        pma::ArenaMemoryResource arena{regionSize, 2.0f, &upstream};
+};
+
+}  // namespace
+
+TEST_F(ArenaMemoryResourceTest, UsedSizeIncludesAlignmentPadding) {
+    ASSERT_EQ(arena.getUsedSize(), 0ul);
+    arena.allocate(1ul, 1ul);
+    void* ptr = arena.allocate(8ul, 64ul);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % 64ul, 0ul);
+    ASSERT_GE(arena.getUsedSize(), 9ul);
+    ASSERT_LE(arena.getUsedSize(), 72ul);
+    ASSERT_EQ(arena.getPeakUsedSize(), arena.getUsedSize());
+}
+
+TEST_F(ArenaMemoryResourceTest, ReleasingToAMarkerRewindsTheUsedSize) {
+    arena.allocate(100ul, 8ul);
+    const auto marker = arena.mark();
+    const auto usedSize = arena.getUsedSize();
+    arena.allocate(200ul, 8ul);
+    arena.allocate(300ul, 8ul);
+    const auto peakUsedSize = arena.getUsedSize();
+
+    arena.release(marker);
+    ASSERT_EQ(arena.getUsedSize(), usedSize);
+    ASSERT_EQ(arena.getPeakUsedSize(), peakUsedSize);
+
+    arena.reset();
+    ASSERT_EQ(arena.getUsedSize(), 0ul);
+    ASSERT_EQ(arena.getPeakUsedSize(), peakUsedSize);
+}
+
+TEST_F(ArenaMemoryResourceTest, RegionsGrowAndAreReusedAfterRewinding) {
+    for (int i = 0; i < 4; ++i) {
+        arena.allocate(regionSize / 2ul, 8ul);
+    }
+    const auto reservedSize = arena.getReservedSize();
+    ASSERT_GT(reservedSize, regionSize);
+    ASSERT_GE(upstream.getStatistics().usedBytes, reservedSize);
+
+    // The regions are kept, so allocating the same again does not allocate from upstream
+    const auto allocationCount = upstream.getStatistics().allocationCount;
+    arena.reset();
+    for (int i = 0; i < 4; ++i) {
+        arena.allocate(regionSize / 2ul, 8ul);
+    }
+    ASSERT_EQ(arena.getReservedSize(), reservedSize);
+    ASSERT_EQ(upstream.getStatistics().allocationCount, allocationCount);
+}
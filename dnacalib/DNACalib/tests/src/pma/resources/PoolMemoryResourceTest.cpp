@@ -0,0 +1,138 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include <pma/resources/DefaultMemoryResource.h>
+#include <pma/resources/PoolMemoryResource.h>
+#include <pma/resources/TrackingMemoryResource.h>
+
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t maxBlockSize = 256ul;
+constexpr std::size_t chunkSize = 4096ul;
+
+class PoolMemoryResourceTest : public ::testing::Test {
+    protected:
+        std::size_t upstreamUsedBytes() const {
+            return upstream.getStatistics().usedBytes;
+        }
+
+    protected:
+        pma::DefaultMemoryResource defaultMemRes;
+        pma::TrackingMemoryResource upstream{&defaultMemRes};
+        pma::PoolMemoryResource pool{maxBlockSize, chunkSize, &upstream};
+};
+
+// Hands over batches of pointers from one thread to another, waiting for each batch to be processed before the next one
+class Handover {
+    public:
+        void give(std::vector<void*>&& batch) {
+            std::unique_lock<std::mutex> lock{mutex};
+            pointers = std::move(batch);
+            full = true;
+            changed.notify_one();
+            changed.wait(lock, [this]() { return !full; });
+        }
+
+        template<typename TProcessor>
+        void process(TProcessor processor) {
+            std::unique_lock<std::mutex> lock{mutex};
+            changed.wait(lock, [this]() { return full; });
+            processor(pointers);
+            full = false;
+            changed.notify_one();
+        }
+
+    private:
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::vector<void*> pointers;
+        bool full = false;
+};
+
+}  // namespace
+
+TEST_F(PoolMemoryResourceTest, BlocksAreAlignedToTheirSize) {
+    for (std::size_t size = 1ul; size <= maxBlockSize; size *= 2ul) {
+        void* ptr = pool.allocate(size, 1ul);
+        ASSERT_NE(ptr, nullptr);
+        const auto blockSize = std::max(size, static_cast<std::size_t>(16ul));
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % blockSize, 0ul);
+        pool.deallocate(ptr, size, 1ul);
+    }
+}
+
+TEST_F(PoolMemoryResourceTest, LargeAllocationsArePassedThrough) {
+    const auto before = upstream.getStatistics();
+    void* ptr = pool.allocate(maxBlockSize + 1ul, 8ul);
+    ASSERT_EQ(upstream.getStatistics().allocationCount, before.allocationCount + 1ul);
+    ASSERT_EQ(upstreamUsedBytes(), before.usedBytes + maxBlockSize + 1ul);
+    pool.deallocate(ptr, maxBlockSize + 1ul, 8ul);
+    ASSERT_EQ(upstreamUsedBytes(), before.usedBytes);
+}
+
+TEST_F(PoolMemoryResourceTest, DeallocatedBlocksAreReused) {
+    void* first = pool.allocate(24ul, 8ul);
+    const auto usedBytes = upstreamUsedBytes();
+    pool.deallocate(first, 24ul, 8ul);
+    void* second = pool.allocate(32ul, 8ul);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(upstreamUsedBytes(), usedBytes);
+    pool.deallocate(second, 32ul, 8ul);
+}
+
+TEST_F(PoolMemoryResourceTest, ChunksAreFreedAlongWithThePool) {
+    const auto usedBytes = upstreamUsedBytes();
+    {
+        pma::PoolMemoryResource local{maxBlockSize, chunkSize, &upstream};
+        std::vector<void*> pointers;
+        for (std::size_t i = 0ul; i < 1000ul; ++i) {
+            pointers.push_back(local.allocate(64ul, 8ul));
+        }
+        for (void* ptr : pointers) {
+            local.deallocate(ptr, 64ul, 8ul);
+        }
+        ASSERT_GT(upstreamUsedBytes(), usedBytes);
+    }
+    ASSERT_EQ(upstreamUsedBytes(), usedBytes);
+}
+
+TEST_F(PoolMemoryResourceTest, BlocksDeallocatedByAnotherThreadAreReused) {
+    constexpr std::size_t roundCount = 64ul;
+    constexpr std::size_t batchSize = 1000ul;
+    constexpr std::size_t blockSize = 64ul;
+
+    Handover handover;
+    std::thread producer{[this, &handover]() {
+        for (std::size_t round = 0ul; round < roundCount; ++round) {
+            std::vector<void*> batch;
+            for (std::size_t i = 0ul; i < batchSize; ++i) {
+                batch.push_back(pool.allocate(blockSize, 8ul));
+            }
+            handover.give(std::move(batch));
+        }
+    }};
+
+    std::size_t usedBytesAfterWarmup = 0ul;
+    for (std::size_t round = 0ul; round < roundCount; ++round) {
+        handover.process([this](const std::vector<void*>& batch) {
+            for (void* ptr : batch) {
+                pool.deallocate(ptr, blockSize, 8ul);
+            }
+        });
+        // The consumer keeps some of the blocks it deallocates around, so the producer allocates a few more chunks first
+        if (round == 3ul) {
+            usedBytesAfterWarmup = upstreamUsedBytes();
+        }
+    }
+    producer.join();
+    // Memory doesn't grow with the number of rounds, as the producer reuses the blocks freed by the consumer
+    ASSERT_EQ(upstreamUsedBytes(), usedBytesAfterWarmup);
+}
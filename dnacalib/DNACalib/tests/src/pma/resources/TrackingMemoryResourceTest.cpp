@@ -0,0 +1,100 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include <pma/resources/DefaultMemoryResource.h>
+#include <pma/resources/TrackingMemoryResource.h>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <string>
+#include <thread>
+
+namespace {
+
+class TrackingMemoryResourceTest : public ::testing::Test {
+    protected:
+        pma::DefaultMemoryResource defaultMemRes;
+        pma::TrackingMemoryResource tracking{&defaultMemRes};
+};
+
+}  // namespace
+
+TEST_F(TrackingMemoryResourceTest, StatisticsAccountAllocationsAndDeallocations) {
+    void* first = tracking.allocate(100ul, 8ul);
+    void* second = tracking.allocate(50ul, 8ul);
+    tracking.deallocate(first, 100ul, 8ul);
+    void* third = tracking.allocate(20ul, 8ul);
+
+    const auto statistics = tracking.getStatistics();
+    ASSERT_EQ(statistics.usedBytes, 70ul);
+    ASSERT_EQ(statistics.peakUsedBytes, 150ul);
+    ASSERT_EQ(statistics.totalAllocatedBytes, 170ul);
+    ASSERT_EQ(statistics.allocationCount, 3ul);
+    ASSERT_EQ(statistics.deallocationCount, 1ul);
+
+    tracking.deallocate(second, 50ul, 8ul);
+    tracking.deallocate(third, 20ul, 8ul);
+    ASSERT_EQ(tracking.getStatistics().usedBytes, 0ul);
+}
+
+TEST_F(TrackingMemoryResourceTest, NestedTagsAreAccountedInTheirEnclosingTags) {
+    void* untagged = tracking.allocate(10ul, 8ul);
+    void* geometry = nullptr;
+    void* mesh = nullptr;
+    {
+        pma::ScopedAllocationTag geometryTag{"geometry"};
+        geometry = tracking.allocate(100ul, 8ul);
+        pma::ScopedAllocationTag meshTag{"mesh", 2ul};
+        mesh = tracking.allocate(40ul, 8ul);
+    }
+
+    ASSERT_EQ(tracking.getStatistics().usedBytes, 150ul);
+    ASSERT_EQ(tracking.getStatistics("geometry").usedBytes, 140ul);
+    ASSERT_EQ(tracking.getStatistics("geometry/mesh[2]").usedBytes, 40ul);
+    ASSERT_EQ(tracking.getStatistics("behavior").allocationCount, 0ul);
+
+    bool found = false;
+    for (std::size_t i = 0ul; i < tracking.getTagCount(); ++i) {
+        if (std::string{tracking.getTag(i)} == "geometry/mesh[2]") {
+            ASSERT_EQ(tracking.getTagStatistics(i).usedBytes, 40ul);
+            found = true;
+        }
+    }
+    ASSERT_TRUE(found);
+
+    tracking.deallocate(mesh, 40ul, 8ul);
+    ASSERT_EQ(tracking.getStatistics("geometry").usedBytes, 100ul);
+    ASSERT_EQ(tracking.getStatistics("geometry/mesh[2]").deallocationCount, 1ul);
+    tracking.deallocate(geometry, 100ul, 8ul);
+    tracking.deallocate(untagged, 10ul, 8ul);
+}
+
+TEST_F(TrackingMemoryResourceTest, DeallocationsAreAttributedToTheTagsOfTheirAllocations) {
+    void* ptr = nullptr;
+    std::thread allocating{[this, &ptr]() {
+            pma::ScopedAllocationTag tag{"behavior"};
+            ptr = tracking.allocate(64ul, 8ul);
+        }};
+    allocating.join();
+    ASSERT_EQ(tracking.getStatistics("behavior").usedBytes, 64ul);
+
+    // Tags of the allocating thread don't apply to the deallocating one
+    pma::ScopedAllocationTag tag{"geometry"};
+    tracking.deallocate(ptr, 64ul, 8ul);
+    ASSERT_EQ(tracking.getStatistics("behavior").usedBytes, 0ul);
+    ASSERT_EQ(tracking.getStatistics("geometry").deallocationCount, 0ul);
+}
+
+TEST(TrackingMemoryResourceTagTest, TagsAreRecordedOnlyWhileATrackingResourceExists) {
+    pma::DefaultMemoryResource defaultMemRes;
+    pma::ScopedAllocationTag untracked{"untracked", 0ul};
+    pma::TrackingMemoryResource tracking{&defaultMemRes};
+    {
+        pma::ScopedAllocationTag tag{"tracked"};
+        void* ptr = tracking.allocate(10ul, 8ul);
+        tracking.deallocate(ptr, 10ul, 8ul);
+    }
+    ASSERT_EQ(tracking.getStatistics("tracked").allocationCount, 1ul);
+    ASSERT_EQ(tracking.getStatistics("untracked[0]").allocationCount, 0ul);
+    ASSERT_EQ(tracking.getStatistics("untracked[0]/tracked").allocationCount, 0ul);
+}
@@ -18,6 +18,8 @@ if hasattr(os, 'add_dll_directory'):
 #include <pma/resources/AlignedMemoryResource.h>
 #include <pma/resources/ArenaMemoryResource.h>
 #include <pma/resources/DefaultMemoryResource.h>
+#include <pma/resources/PoolMemoryResource.h>
+#include <pma/resources/TrackingMemoryResource.h>
 #include <status/Defs.h>
 #include <status/StatusCode.h>
 #include <status/Status.h>
@@ -26,12 +28,16 @@ if hasattr(os, 'add_dll_directory'):
 #include <trio/Stream.h>
 #include <trio/types/Aliases.h>
 #include <trio/types/Parameters.h>
+#include <trio/streams/BufferedStream.h>
 #include <trio/streams/FileStream.h>
 #include <trio/streams/MemoryMappedFileStream.h>
 #include <trio/streams/MemoryStream.h>
 
 #include "dna/Defs.h"
+#include "dna/ByteOrder.h"
 #include "dna/DataLayer.h"
+#include "dna/MemoryReport.h"
+#include "dna/ReadMode.h"
 #include "dna/types/ArrayView.h"
 #include "dna/types/StringView.h"
 #include "dna/types/Aliases.h"
@@ -46,6 +52,7 @@ if hasattr(os, 'add_dll_directory'):
 #include "dna/StreamReader.h"
 #include "dna/BinaryStreamReader.h"
 #include "dna/JSONStreamReader.h"
+#include "dna/LazyBinaryStreamReader.h"
 
 #include "dna/layers/DescriptorWriter.h"
 #include "dna/layers/DefinitionWriter.h"
@@ -70,6 +77,8 @@ if hasattr(os, 'add_dll_directory'):
 %include <pma/resources/AlignedMemoryResource.h>
 %include <pma/resources/ArenaMemoryResource.h>
 %include <pma/resources/DefaultMemoryResource.h>
+%include <pma/resources/PoolMemoryResource.h>
+%include <pma/resources/TrackingMemoryResource.h>
 %include <status/Defs.h>
 %include <status/StatusCode.h>
 %include <status/Status.h>
@@ -78,9 +87,11 @@ if hasattr(os, 'add_dll_directory'):
 %include <trio/Stream.h>
 %include <trio/types/Aliases.h>
 %include <trio/types/Parameters.h>
+%include <trio/streams/BufferedStream.h>
 %include <trio/streams/FileStream.h>
 %include <trio/streams/MemoryMappedFileStream.h>
 %include <trio/streams/MemoryStream.h>
+pythonize_unmanaged_type(BufferedStream, create, destroy)
 pythonize_unmanaged_type(FileStream, create, destroy)
 pythonize_unmanaged_type(MemoryMappedFileStream, create, destroy)
 pythonize_unmanaged_type(MemoryStream, create, destroy)
@@ -160,7 +171,10 @@ py_list_to_c_array(const dna::Normal* normals, std::uint32_t count);
 %include "dna/types/StringView.h"
 %include "dna/types/Aliases.h"
 %include "dna/types/Vector3.h"
+%include "dna/ByteOrder.h"
 %include "dna/DataLayer.h"
+%include "dna/MemoryReport.h"
+%include "dna/ReadMode.h"
 %include "dna/layers/Descriptor.h"
 %include "dna/layers/Geometry.h"
 %include "dna/layers/DescriptorReader.h"
@@ -171,8 +185,10 @@ py_list_to_c_array(const dna::Normal* normals, std::uint32_t count);
 %include "dna/StreamReader.h"
 %include "dna/BinaryStreamReader.h"
 %include "dna/JSONStreamReader.h"
+%include "dna/LazyBinaryStreamReader.h"
 pythonize_unmanaged_type(BinaryStreamReader, create, destroy)
 pythonize_unmanaged_type(JSONStreamReader, create, destroy)
+pythonize_unmanaged_type(LazyBinaryStreamReader, create, destroy)
 %include "dna/layers/DescriptorWriter.h"
 %include "dna/layers/DefinitionWriter.h"
 %include "dna/layers/BehaviorWriter.h"